@@ -21,12 +21,37 @@ public:
         int rootMidiNote;
     };
 
-    MidiPlayer(juce::AudioProcessor &processor)
-        : apvts(processor, nullptr, "Parameters", createParameterLayout())
+    // One drum in a kit: a sample played at its original pitch on a single MIDI note
+    struct Pad
+    {
+        juce::String name;
+        int midiNote;
+        const void *sampleData;
+        int sampleDataSize; // matches the BinaryData size type
+        float gain = 1.0f;
+        float pan = 0.0f;   // -1 (left) to 1 (right)
+        int chokeGroup = 0; // pads sharing a non-zero group cut each other off
+        double attack = 0.0;  // seconds
+        double release = 0.1; // seconds
+        double maxSampleLength = 10.0;
+    };
+
+    // A kit is listed alongside the presets and loads all of its pads at once.
+    // Pad n renders to extra output bus n + 1 when the host enables it.
+    struct Kit
+    {
+        juce::String name;
+        std::vector<Pad> pads;
+    };
+
+    MidiPlayer(juce::AudioProcessor &processor, int polyphony = defaultPolyphony)
+        : apvts(processor, nullptr, "Parameters", createParameterLayout()),
+          synth(polyphony)
     {
         formatManager.registerBasicFormats();
-        for (int i = 0; i < numVoices; ++i)
-            synth.addVoice(new juce::SamplerVoice());
+
+        // Samples are brought to the session rate in prepareToPlay rather than per voice
+        synth.setResampleToPlaybackRate(true);
 
         addAndMakeVisible(presetBox);
 
@@ -102,6 +127,38 @@ public:
         presets.push_back({name, attack, release, maxSampleLength,
                            sampleData, sampleDataSize, rootMidiNote});
 
+        refreshPresetList(name);
+    }
+
+    void addKit(const juce::String &name, std::vector<Pad> pads)
+    {
+        kits.push_back({name, std::move(pads)});
+
+        refreshPresetList(name);
+    }
+
+    // Changes a pad's mix in every kit using that note, including the loaded one
+    void setPadMix(int midiNote, float gain, float pan)
+    {
+        for (auto &kit : kits)
+            for (auto &pad : kit.pads)
+                if (pad.midiNote == midiNote)
+                {
+                    pad.gain = gain;
+                    pad.pan = pan;
+                }
+
+        for (int i = 0; i < synth.getNumSounds(); ++i)
+            if (auto *sound = dynamic_cast<SampleSound *>(synth.getSound(i).get()))
+                if (sound->appliesToNote(midiNote))
+                {
+                    sound->setGain(gain);
+                    sound->setPan(pan);
+                }
+    }
+
+    void refreshPresetList(const juce::String &lastAddedName)
+    {
         presetBox.clear();
         parameterChoices.clear();
 
@@ -109,6 +166,8 @@ public:
         std::vector<juce::String> presetNames;
         for (const auto &preset : presets)
             presetNames.push_back(preset.name);
+        for (const auto &kit : kits)
+            presetNames.push_back(kit.name);
 
         std::sort(presetNames.begin(), presetNames.end(),
                   [](const juce::String &a, const juce::String &b)
@@ -126,10 +185,10 @@ public:
             parameterChoices.add("No Presets");
 
         // Set the selected preset
-        if (presets.size() == 1)
+        if (presetNames.size() == 1)
             presetBox.setSelectedId(1);
         else
-            presetBox.setText(presets.back().name);
+            presetBox.setText(lastAddedName);
 
         // Update the parameter value
         if (auto *choiceParam = dynamic_cast<juce::AudioParameterChoice *>(
@@ -148,13 +207,20 @@ public:
         lastPresetName = presetBox.getText();
     }
 
+    // Number of simultaneous voices (1 to PolySynthesiser::maxPolyphony)
+    void setPolyphony(int numVoices) { synth.setPolyphony(numVoices); }
+    int getPolyphony() const { return synth.getPolyphony(); }
+
     void prepareToPlay(double sampleRate)
     {
         synth.setCurrentPlaybackSampleRate(sampleRate);
     }
 
+    // padOutputs are optional extra bus buffers (usually views into buffer) that kit pads render into
     void processBlock(juce::AudioBuffer<float> &buffer,
-                      juce::MidiBuffer &midiMessages)
+                      juce::MidiBuffer &midiMessages,
+                      juce::AudioBuffer<float> *const *padOutputs = nullptr,
+                      int numPadOutputs = 0)
     {
         buffer.clear();
 
@@ -168,7 +234,9 @@ public:
                 currentNotes.removeFirstMatchingValue(message.getNoteNumber());
         }
 
+        synth.setOutputBuses(padOutputs, numPadOutputs);
         synth.renderNextBlock(buffer, midiMessages, 0, buffer.getNumSamples());
+        synth.setOutputBuses(nullptr, 0);
 
         float peak = 0.0f;
         for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
@@ -181,7 +249,9 @@ public:
         g.fillAll(findColour(juce::ResizableWindow::backgroundColourId));
         g.setColour(juce::Colours::white);
         g.setFont(15.0f);
-        g.drawFittedText("Choose a preset, then play C3 on your Midi...",
+        // A kit answers on its pads' notes only, so list them instead of C3
+        g.drawFittedText(padNotes.isEmpty() ? juce::String("Choose a preset, then play C3 on your Midi...")
+                                            : "Play the pads: " + padNotes,
                          getLocalBounds(), juce::Justification::centredTop, 1);
     }
 
@@ -335,78 +405,83 @@ public:
 
     void selectPresetByName(const juce::String &name)
     {
+        for (auto &k : kits)
+            if (k.name == name)
+            {
+                loadKit(k);
+                return;
+            }
+
         for (auto &p : presets)
             if (p.name == name)
             {
                 auto stream = std::make_unique<juce::MemoryInputStream>(p.sampleData,
                                                                         p.sampleDataSize,
                                                                         false);
-                if (auto reader = formatManager.createReaderFor(std::move(stream)))
+                if (auto reader = std::unique_ptr<juce::AudioFormatReader>(formatManager.createReaderFor(std::move(stream))))
                 {
                     synth.clearSounds();
+                    padNotes.clear();
                     juce::BigInteger allNotes;
                     allNotes.setRange(0, 128, true);
-                    synth.addSound(new juce::SamplerSound(p.name,
-                                                          *reader,
-                                                          allNotes,
-                                                          p.rootMidiNote,
-                                                          p.attack,
-                                                          p.release,
-                                                          p.maxSampleLength));
+                    synth.addSound(new SampleSound(p.name,
+                                                    *reader,
+                                                    allNotes,
+                                                    p.rootMidiNote,
+                                                    p.attack,
+                                                    p.release,
+                                                    p.maxSampleLength));
+                    synth.resampleSounds();
                 }
                 return;
             }
     }
 
 private:
-    juce::String lastPresetName;
-    juce::AudioProcessorValueTreeState apvts;
-    void selectPreset(int comboBoxIndex)
+    // Every pad becomes its own sound in the shared voice pool
+    void loadKit(const Kit &kit)
     {
-        // Get the selected preset name from the combo box
-        juce::String selectedName = presetBox.getText();
+        synth.clearSounds();
+        padNotes.clear();
 
-        // Find the matching preset in the presets vector
-        for (size_t i = 0; i < presets.size(); ++i)
+        for (size_t i = 0; i < kit.pads.size(); ++i)
         {
-            if (presets[i].name == selectedName)
+            auto &pad = kit.pads[i];
+            auto stream = std::make_unique<juce::MemoryInputStream>(pad.sampleData,
+                                                                    (size_t)pad.sampleDataSize,
+                                                                    false);
+            if (auto reader = std::unique_ptr<juce::AudioFormatReader>(formatManager.createReaderFor(std::move(stream))))
             {
-                auto &p = presets[i];
-
-                synth.clearSounds();
-
-                auto stream = std::make_unique<juce::MemoryInputStream>(p.sampleData,
-                                                                        p.sampleDataSize,
-                                                                        false);
-
-                std::unique_ptr<juce::AudioFormatReader> reader(
-                    formatManager.createReaderFor(std::move(stream)));
-
-                if (reader != nullptr)
-                {
-                    juce::BigInteger allNotes;
-                    allNotes.setRange(0, 128, true);
-
-                    synth.addSound(new juce::SamplerSound(p.name,
-                                                          *reader,
-                                                          allNotes,
-                                                          p.rootMidiNote,
-                                                          p.attack,
-                                                          p.release,
-                                                          p.maxSampleLength));
-                }
-
-                return;
+                juce::BigInteger padNote;
+                padNote.setBit(pad.midiNote);
+
+                auto *sound = new SampleSound(pad.name, *reader, padNote, pad.midiNote,
+                                              pad.attack, pad.release, pad.maxSampleLength);
+                sound->setGain(pad.gain);
+                sound->setPan(pad.pan);
+                sound->setChokeGroup(pad.chokeGroup);
+                sound->setOutputBus((int)i + 1);
+                synth.addSound(sound);
+
+                if (padNotes.isNotEmpty())
+                    padNotes += ", ";
+                padNotes += pad.name + " " + juce::String(pad.midiNote);
             }
         }
+
+        synth.resampleSounds();
     }
 
+    juce::String lastPresetName;
+    juce::String padNotes; // "Kick 36, Snare 38, ..." while a kit is loaded, else empty
+    juce::AudioProcessorValueTreeState apvts;
+    PolySynthesiser synth;
     void timerCallback() override { repaint(); }
 
-    static constexpr int numVoices = 8;
-    juce::Synthesiser synth;
+    static constexpr int defaultPolyphony = 8;
     juce::AudioFormatManager formatManager;
     std::vector<Preset> presets;
+    std::vector<Kit> kits;
     juce::ComboBox presetBox;
     std::atomic<float> level{1.0f};
     juce::Array<int> currentNotes;
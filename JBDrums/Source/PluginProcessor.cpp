@@ -18,11 +18,32 @@ JBDrumsAudioProcessor::JBDrumsAudioProcessor()
                          .withInput("Input", juce::AudioChannelSet::stereo(), true)
 #endif
                          .withOutput("Output", juce::AudioChannelSet::stereo(), true)
+                         .withOutput("Pad 1", juce::AudioChannelSet::stereo(), false)
+                         .withOutput("Pad 2", juce::AudioChannelSet::stereo(), false)
+                         .withOutput("Pad 3", juce::AudioChannelSet::stereo(), false)
+                         .withOutput("Pad 4", juce::AudioChannelSet::stereo(), false)
+                         .withOutput("Pad 5", juce::AudioChannelSet::stereo(), false)
 #endif
                          ),
-      midiPlayer(*this)
+      midiPlayer(*this, 64) // enough voices for fast hi-hat rolls to ring out
 #endif
 {
+    // Kits: a whole kit in one instance, mapped to General MIDI drum notes (hi-hats choke each other)
+    midiPlayer.addKit("Rock Kit", {{"Kick", 36, BinaryData::Rock_Kick_1_wav, BinaryData::Rock_Kick_1_wavSize},
+                                   {"Snare", 38, BinaryData::Rock_Snare_1_wav, BinaryData::Rock_Snare_1_wavSize},
+                                   {"Snare 2", 40, BinaryData::Rock_Snare_3_wav, BinaryData::Rock_Snare_3_wavSize},
+                                   {"Hi-Hat", 42, BinaryData::Rock_HiHat_1_wav, BinaryData::Rock_HiHat_1_wavSize, 0.9f, 0.2f, 1},
+                                   {"Hi-Hat 2", 44, BinaryData::Rock_HiHat_3_wav, BinaryData::Rock_HiHat_3_wavSize, 0.9f, 0.2f, 1}});
+    midiPlayer.addKit("Boom Bap Kit", {{"Kick", 36, BinaryData::Boom_Bap_Kick_wav, BinaryData::Boom_Bap_Kick_wavSize},
+                                       {"Snare", 38, BinaryData::Boom_Bap_Snare_wav, BinaryData::Boom_Bap_Snare_wavSize},
+                                       {"Hi-Hat", 42, BinaryData::Boom_Bap_HiHat_wav, BinaryData::Boom_Bap_HiHat_wavSize, 0.9f, 0.2f, 1},
+                                       {"Open Hi-Hat", 46, BinaryData::Boom_Bap_Open_HiHat_wav, BinaryData::Boom_Bap_Open_HiHat_wavSize, 0.9f, 0.2f, 1}});
+    midiPlayer.addKit("Trap Kit", {{"808", 35, BinaryData::Trap_808_C3_wav, BinaryData::Trap_808_C3_wavSize},
+                                   {"Kick", 36, BinaryData::Trap_Kick_wav, BinaryData::Trap_Kick_wavSize},
+                                   {"Snare", 38, BinaryData::Trap_Snare_wav, BinaryData::Trap_Snare_wavSize},
+                                   {"Hi-Hat", 42, BinaryData::Trap_HiHat_wav, BinaryData::Trap_HiHat_wavSize, 0.9f, 0.2f, 1},
+                                   {"Hi-Hat 2", 44, BinaryData::Trap_HiHat_2_wav, BinaryData::Trap_HiHat_2_wavSize, 0.9f, 0.2f, 1}});
+
     // Add all presets
     midiPlayer.addPreset("Rock Hi-Hat", 0.0, 0.1, 10.0, BinaryData::Rock_HiHat_1_wav, BinaryData::Rock_HiHat_1_wavSize);
     midiPlayer.addPreset("Rock Hi-Hat 2", 0.0, 0.1, 10.0, BinaryData::Rock_HiHat_3_wav, BinaryData::Rock_HiHat_3_wavSize);
@@ -145,6 +166,11 @@ bool JBDrumsAudioProcessor::isBusesLayoutSupported(const BusesLayout &layouts) c
         return false;
 #endif
 
+    // Pad outputs are either off or stereo
+    for (int bus = 1; bus < layouts.outputBuses.size(); ++bus)
+        if (!layouts.outputBuses[bus].isDisabled() && layouts.outputBuses[bus] != juce::AudioChannelSet::stereo())
+            return false;
+
     return true;
 #endif
 }
@@ -152,7 +178,17 @@ bool JBDrumsAudioProcessor::isBusesLayoutSupported(const BusesLayout &layouts) c
 
 void JBDrumsAudioProcessor::processBlock(juce::AudioBuffer<float> &buffer, juce::MidiBuffer &midiMessages)
 {
-    midiPlayer.processBlock(buffer, midiMessages);
+    // Bus buffers are views onto channels of buffer, so pads render straight into
+    // their own output without an intermediate mix
+    std::array<juce::AudioBuffer<float>, numPadOutputs> padBuffers;
+    std::array<juce::AudioBuffer<float> *, numPadOutputs> padOutputs;
+    for (int i = 0; i < numPadOutputs; ++i)
+    {
+        padBuffers[(size_t)i] = getBusBuffer(buffer, false, i + 1);
+        padOutputs[(size_t)i] = &padBuffers[(size_t)i];
+    }
+
+    midiPlayer.processBlock(buffer, midiMessages, padOutputs.data(), numPadOutputs);
 }
 
 //==============================================================================
@@ -10,6 +10,7 @@
 
 #include <JuceHeader.h>
 #include "MidiPlayer.h"
+#include <array>
 
 //==============================================================================
 /**
@@ -54,6 +55,9 @@ public:
   void getStateInformation(juce::MemoryBlock &destData) override;
   void setStateInformation(const void *data, int sizeInBytes) override;
 
+  // Extra stereo outputs, one per kit pad (disabled until the host enables them)
+  static constexpr int numPadOutputs = 5;
+
   MidiPlayer midiPlayer; // Instance of the MidiPlayer class
 
 private:
@@ -1,7 +1,5 @@
 #pragma once
 #include <JuceHeader.h>
-#include "../DSP/Fifo.h"
-#include "../DSP/DSPUtilities.h"
 
 class BasicAudioProcessor : public juce::AudioProcessor
 {
@@ -2,7 +2,6 @@
 
 #include <JuceHeader.h>
 #include "../GUI/FFTComponents.h"
-#include "../DSP/DSPUtilities.h"
 #include "../DSP/BasicAudioProcessor.h"
 #include "../Settings.h"
 
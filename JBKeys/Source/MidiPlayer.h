@@ -21,12 +21,14 @@ public:
         int rootMidiNote;
     };
 
-    MidiPlayer(juce::AudioProcessor &processor)
-        : apvts(processor, nullptr, "Parameters", createParameterLayout())
+    MidiPlayer(juce::AudioProcessor &processor, int polyphony = defaultPolyphony)
+        : apvts(processor, nullptr, "Parameters", createParameterLayout()),
+          synth(polyphony)
     {
         formatManager.registerBasicFormats();
-        for (int i = 0; i < numVoices; ++i)
-            synth.addVoice(new juce::SamplerVoice());
+
+        // Samples are brought to the session rate in prepareToPlay rather than per voice
+        synth.setResampleToPlaybackRate(true);
 
         addAndMakeVisible(presetBox);
 
@@ -102,6 +104,11 @@ public:
         presets.push_back({name, attack, release, maxSampleLength,
                            sampleData, sampleDataSize, rootMidiNote});
 
+        refreshPresetList(name);
+    }
+
+    void refreshPresetList(const juce::String &lastAddedName)
+    {
         presetBox.clear();
         parameterChoices.clear();
 
@@ -126,10 +133,10 @@ public:
             parameterChoices.add("No Presets");
 
         // Set the selected preset
-        if (presets.size() == 1)
+        if (presetNames.size() == 1)
             presetBox.setSelectedId(1);
         else
-            presetBox.setText(presets.back().name);
+            presetBox.setText(lastAddedName);
 
         // Update the parameter value
         if (auto *choiceParam = dynamic_cast<juce::AudioParameterChoice *>(
@@ -148,13 +155,16 @@ public:
         lastPresetName = presetBox.getText();
     }
 
+    // Number of simultaneous voices (1 to PolySynthesiser::maxPolyphony)
+    void setPolyphony(int numVoices) { synth.setPolyphony(numVoices); }
+    int getPolyphony() const { return synth.getPolyphony(); }
+
     void prepareToPlay(double sampleRate)
     {
         synth.setCurrentPlaybackSampleRate(sampleRate);
     }
 
-    void processBlock(juce::AudioBuffer<float> &buffer,
-                      juce::MidiBuffer &midiMessages)
+    void processBlock(juce::AudioBuffer<float> &buffer, juce::MidiBuffer &midiMessages)
     {
         buffer.clear();
 
@@ -341,18 +351,19 @@ public:
                 auto stream = std::make_unique<juce::MemoryInputStream>(p.sampleData,
                                                                         p.sampleDataSize,
                                                                         false);
-                if (auto reader = formatManager.createReaderFor(std::move(stream)))
+                if (auto reader = std::unique_ptr<juce::AudioFormatReader>(formatManager.createReaderFor(std::move(stream))))
                 {
                     synth.clearSounds();
                     juce::BigInteger allNotes;
                     allNotes.setRange(0, 128, true);
-                    synth.addSound(new juce::SamplerSound(p.name,
-                                                          *reader,
-                                                          allNotes,
-                                                          p.rootMidiNote,
-                                                          p.attack,
-                                                          p.release,
-                                                          p.maxSampleLength));
+                    synth.addSound(new SampleSound(p.name,
+                                                    *reader,
+                                                    allNotes,
+                                                    p.rootMidiNote,
+                                                    p.attack,
+                                                    p.release,
+                                                    p.maxSampleLength));
+                    synth.resampleSounds();
                 }
                 return;
             }
@@ -361,50 +372,10 @@ public:
 private:
     juce::String lastPresetName;
     juce::AudioProcessorValueTreeState apvts;
-    void selectPreset(int comboBoxIndex)
-    {
-        // Get the selected preset name from the combo box
-        juce::String selectedName = presetBox.getText();
-
-        // Find the matching preset in the presets vector
-        for (size_t i = 0; i < presets.size(); ++i)
-        {
-            if (presets[i].name == selectedName)
-            {
-                auto &p = presets[i];
-
-                synth.clearSounds();
-
-                auto stream = std::make_unique<juce::MemoryInputStream>(p.sampleData,
-                                                                        p.sampleDataSize,
-                                                                        false);
-
-                std::unique_ptr<juce::AudioFormatReader> reader(
-                    formatManager.createReaderFor(std::move(stream)));
-
-                if (reader != nullptr)
-                {
-                    juce::BigInteger allNotes;
-                    allNotes.setRange(0, 128, true);
-
-                    synth.addSound(new juce::SamplerSound(p.name,
-                                                          *reader,
-                                                          allNotes,
-                                                          p.rootMidiNote,
-                                                          p.attack,
-                                                          p.release,
-                                                          p.maxSampleLength));
-                }
-
-                return;
-            }
-        }
-    }
-
+    PolySynthesiser synth;
     void timerCallback() override { repaint(); }
 
-    static constexpr int numVoices = 8;
-    juce::Synthesiser synth;
+    static constexpr int defaultPolyphony = 8;
     juce::AudioFormatManager formatManager;
     std::vector<Preset> presets;
     juce::ComboBox presetBox;
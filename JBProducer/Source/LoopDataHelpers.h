@@ -1,19 +1,20 @@
 #pragma once
 #include <variant>
 #include <array>
+#include <memory>
+#include <vector>
 #include <JuceHeader.h>
 #include "LoopData.h"
-#include "Service/RhythmGenerator.h"
-#include "Service/MidiToAudio.h"
 
 namespace LoopDataHelpers
 {
-    // unify both Loop8 and Loop16 into a single variant
-    using AnyLoopData = std::variant<LoopData<Loop8>, LoopData<Loop16>>;
+    // unify both 8th and 16th note loops into a single variant
+    using AnyLoopData = std::variant<LoopData<PackedLoop8>, LoopData<PackedLoop16>>;
 
     // pack them into a constexpr array
     static constexpr int kNumLoops = LOOP_DATA_COUNT;
-    static const std::array<AnyLoopData, kNumLoops> allLoops = {
+    static constexpr double kBeatsPerLoop = 16.0; // every loop is 4 bars of 4/4
+    static constexpr std::array<AnyLoopData, kNumLoops> allLoops = {
         loopData1,
         loopData2,
         loopData3,
@@ -31,6 +32,22 @@ namespace LoopDataHelpers
         loopData15,
         loopData16};
 
+    // a full groove: several loops layered and rendered as one, e.g. kick + snare + hi-hat
+    struct KitLoop
+    {
+        juce::String name;
+        int index;
+        std::vector<int> layers; // ids of loops in allLoops
+    };
+
+    static constexpr int kNumKits = 4;
+    static const std::array<KitLoop, kNumKits> allKits = {{
+        {"Kit: Basic", 101, {6, 3, 1}},
+        {"Kit: Trap", 102, {10, 4, 2}},
+        {"Kit: Drake", 103, {9, 4, 2}},
+        {"Kit: Boom Bap", 104, {16, 3, 1}},
+    }};
+
     // lookup by index
     inline const AnyLoopData &getLoopById(int id)
     {
@@ -42,22 +59,148 @@ namespace LoopDataHelpers
         return allLoops.front(); // fallback
     }
 
-    // names for filling a ComboBox dynamically
+    // the kit with this index, or nullptr if it's a single loop
+    inline const KitLoop *getKitById(int id)
+    {
+        for (auto &kit : allKits)
+            if (kit.index == id)
+                return &kit;
+
+        return nullptr;
+    }
+
+    // ids for filling a ComboBox dynamically: every loop, then every kit
+    inline juce::Array<int> getLoopIds()
+    {
+        juce::Array<int> ids;
+        for (auto &ld : allLoops)
+            ids.add(std::visit([](auto &d)
+                               { return d.index; }, ld));
+        for (auto &kit : allKits)
+            ids.add(kit.index);
+        return ids;
+    }
+
+    // names for filling a ComboBox dynamically, in the same order as getLoopIds
     inline juce::StringArray getLoopNames()
     {
         juce::StringArray names;
         for (auto &ld : allLoops)
             names.add(std::visit([](auto &d)
                                  { return d.name; }, ld));
+        for (auto &kit : allKits)
+            names.add(kit.name);
         return names;
     }
 
-    // generate a MemoryBlock containing the MIDI file
+    // the notes of a single loop
+    inline RhythmGenerator::Pattern getPattern(const AnyLoopData &ld)
+    {
+        return std::visit([](auto &d)
+                          { return RhythmGenerator::toPattern(d.loop); }, ld);
+    }
+
+    // the notes of every layer of a kit, in order
+    inline std::vector<RhythmGenerator::Pattern> getKitPatterns(const KitLoop &kit)
+    {
+        std::vector<RhythmGenerator::Pattern> layers;
+        for (int layerId : kit.layers)
+            layers.push_back(getPattern(getLoopById(layerId)));
+        return layers;
+    }
+
+    // length of a rendered kit: same rule as MidiToAudio::convert, for the longest layer
+    inline int getKitLengthInSamples(const std::vector<RhythmGenerator::Pattern> &layers,
+                                     float bpm,
+                                     double sampleRate)
+    {
+        int numBeats = 0;
+        for (auto &layer : layers)
+            numBeats = juce::jmax(numBeats, layer.getNumBeats());
+        return static_cast<int>(sampleRate * 60.0 / bpm) * numBeats;
+    }
+
+    // lay out the hits of every layer of a kit, once per render. Each layer's
+    // sample is decoded and repitched once, through the shared caches
+    inline std::vector<MidiToAudio::HitList> getKitHits(const KitLoop &kit,
+                                                        const std::vector<RhythmGenerator::Pattern> &layers,
+                                                        float bpm,
+                                                        double sampleRate)
+    {
+        std::vector<MidiToAudio::HitList> layerHits;
+        for (size_t i = 0; i < layers.size(); ++i)
+            std::visit([&](auto &d)
+                       { layerHits.push_back(MidiToAudio::prepareHits(layers[i], d.sample, d.sampleSize, bpm, sampleRate)); },
+                       getLoopById(kit.layers[i]));
+        return layerHits;
+    }
+
+    // the notes of any loop, one pattern per layer (a single loop has just one)
+    inline std::vector<RhythmGenerator::Pattern> getLayerPatterns(int id)
+    {
+        if (auto *kit = getKitById(id))
+            return getKitPatterns(*kit);
+
+        return {getPattern(getLoopById(id))};
+    }
+
+    // lay out the hits of every layer of any loop, once per render
+    inline std::vector<MidiToAudio::HitList> getLayerHits(int id,
+                                                          const std::vector<RhythmGenerator::Pattern> &layers,
+                                                          float bpm,
+                                                          double sampleRate)
+    {
+        if (auto *kit = getKitById(id))
+            return getKitHits(*kit, layers, bpm, sampleRate);
+
+        return {std::visit([&](auto &d)
+                           { return MidiToAudio::prepareHits(layers.front(), d.sample, d.sampleSize, bpm, sampleRate); },
+                           getLoopById(id))};
+    }
+
+    // mix every layer of a kit into output, which holds the kit from sample bufferStart on
+    inline void addKitToBuffer(juce::AudioBuffer<float> &output,
+                               int bufferStart,
+                               const std::vector<MidiToAudio::HitList> &layerHits)
+    {
+        for (auto &hits : layerHits)
+            MidiToAudio::addToBuffer(output, bufferStart, hits);
+    }
+
+    // generate a MemoryBlock containing the MIDI file (one track per layer for kits)
     inline juce::MemoryBlock makeMidiBlock(int id, float bpm)
     {
+        if (auto *kit = getKitById(id))
+            return RhythmGenerator::createMIDISequence(getKitPatterns(*kit), bpm);
+
         auto &ld = getLoopById(id);
         return std::visit([&](auto &d)
-                          { return RhythmGenerator::createMIDISequence(d.loop, bpm); }, ld);
+                          { return RhythmGenerator::createMIDISequence(RhythmGenerator::toPattern(d.loop), bpm); }, ld);
+    }
+
+    // render the audio loop into a buffer (every layer mixed in one pass for kits)
+    inline juce::AudioBuffer<float> makeAudioBuffer(int id,
+                                                    float bpm,
+                                                    int numChannels,
+                                                    double sampleRate)
+    {
+        if (auto *kit = getKitById(id))
+        {
+            const auto layers = getKitPatterns(*kit);
+            juce::AudioBuffer<float> output(numChannels, getKitLengthInSamples(layers, bpm, sampleRate));
+            output.clear();
+            addKitToBuffer(output, 0, getKitHits(*kit, layers, bpm, sampleRate));
+            return output;
+        }
+
+        auto &ld = getLoopById(id);
+        return std::visit([&](auto &d)
+                          { return MidiToAudio::convert(RhythmGenerator::toPattern(d.loop),
+                                                        d.sample,
+                                                        d.sampleSize,
+                                                        bpm,
+                                                        numChannels,
+                                                        sampleRate); }, ld);
     }
 
     // generate a MemoryBlock containing the WAV file
@@ -66,13 +209,57 @@ namespace LoopDataHelpers
                                             int numChannels,
                                             double sampleRate)
     {
+        if (getKitById(id) != nullptr)
+            return WavWriter::createWavFile(makeAudioBuffer(id, bpm, numChannels, sampleRate), sampleRate);
+
         auto &ld = getLoopById(id);
         return std::visit([&](auto &d)
-                          { return MidiToAudio::convertToWavFile(d.loop,
+                          { return MidiToAudio::convertToWavFile(RhythmGenerator::toPattern(d.loop),
                                                                  d.sample,
                                                                  d.sampleSize,
                                                                  bpm,
                                                                  numChannels,
                                                                  sampleRate); }, ld);
     }
+
+    // render the audio loop straight into a WAV file, a block at a time, so the
+    // whole loop is never held in memory (bitsPerSample: 16, 24 or 32 for float)
+    inline bool writeAudioFile(int id,
+                               const juce::File &file,
+                               float bpm,
+                               int numChannels,
+                               double sampleRate,
+                               int bitsPerSample)
+    {
+        if (!file.deleteFile())
+            return false;
+
+        std::unique_ptr<juce::OutputStream> stream = file.createOutputStream();
+        if (stream == nullptr)
+            return false;
+
+        if (auto *kit = getKitById(id))
+        {
+            const auto layers = getKitPatterns(*kit);
+            const auto layerHits = getKitHits(*kit, layers, bpm, sampleRate);
+            return WavWriter::writeWavFile(std::move(stream),
+                                           getKitLengthInSamples(layers, bpm, sampleRate),
+                                           numChannels,
+                                           sampleRate,
+                                           bitsPerSample,
+                                           [&](juce::AudioBuffer<float> &block, int blockStart)
+                                           { addKitToBuffer(block, blockStart, layerHits); });
+        }
+
+        auto &ld = getLoopById(id);
+        return std::visit([&](auto &d)
+                          { return MidiToAudio::writeWavFile(std::move(stream),
+                                                             RhythmGenerator::toPattern(d.loop),
+                                                             d.sample,
+                                                             d.sampleSize,
+                                                             bpm,
+                                                             numChannels,
+                                                             sampleRate,
+                                                             bitsPerSample); }, ld);
+    }
 }
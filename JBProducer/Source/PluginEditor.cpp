@@ -10,6 +10,63 @@
 #include "PluginEditor.h"
 #include "LoopDataHelpers.h"
 
+//==============================================================================
+// Renders an audio loop (and its WAV file) off the message thread, then hands
+// the result to the callback on the message thread unless it was cancelled
+class JBProducerAudioProcessorEditor::LoopRenderJob : public juce::ThreadPoolJob
+{
+public:
+  using Callback = std::function<void(std::shared_ptr<RenderedLoop>)>;
+
+  LoopRenderJob(int loopId, float bpm, double sampleRate, Callback onRendered)
+      : juce::ThreadPoolJob("Loop render"),
+        loopId(loopId), bpm(bpm), sampleRate(sampleRate), onRendered(std::move(onRendered))
+  {
+  }
+
+  JobStatus runJob() override
+  {
+    auto loop = std::make_shared<RenderedLoop>();
+    loop->loopId = loopId;
+    loop->bpm = bpm;
+    loop->sampleRate = sampleRate;
+    const auto layers = LoopDataHelpers::getLayerPatterns(loopId);
+    for (auto &layer : layers)
+      loop->lengthInBeats = juce::jmax(loop->lengthInBeats, (double)layer.getNumBeats());
+    const auto layerHits = LoopDataHelpers::getLayerHits(loopId, layers, bpm, sampleRate);
+    loop->audio.setSize(2, LoopDataHelpers::getKitLengthInSamples(layers, bpm, sampleRate));
+    loop->audio.clear();
+
+    // Mix a block at a time, so a cancelled render stops promptly
+    for (int blockStart = 0; blockStart < loop->audio.getNumSamples(); blockStart += WavWriter::streamBlockSize)
+    {
+      if (shouldExit())
+        return jobHasFinished;
+
+      const int numSamples = juce::jmin(WavWriter::streamBlockSize, loop->audio.getNumSamples() - blockStart);
+      juce::AudioBuffer<float> block(loop->audio.getArrayOfWritePointers(), loop->audio.getNumChannels(), blockStart, numSamples);
+      LoopDataHelpers::addKitToBuffer(block, blockStart, layerHits);
+    }
+
+    if (shouldExit())
+      return jobHasFinished;
+
+    loop->wav = WavWriter::createWavFile(loop->audio, sampleRate);
+    if (shouldExit())
+      return jobHasFinished;
+
+    juce::MessageManager::callAsync([callback = onRendered, loop]
+                                    { callback(loop); });
+    return jobHasFinished;
+  }
+
+private:
+  int loopId;
+  float bpm;
+  double sampleRate;
+  Callback onRendered;
+};
+
 //==============================================================================
 JBProducerAudioProcessorEditor::JBProducerAudioProcessorEditor(JBProducerAudioProcessor &p)
     : AudioProcessorEditor(&p), audioProcessor(p)
@@ -19,13 +76,21 @@ JBProducerAudioProcessorEditor::JBProducerAudioProcessorEditor(JBProducerAudioPr
   addAndMakeVisible(loopSelector);
   //
   auto names = LoopDataHelpers::getLoopNames();
+  auto ids = LoopDataHelpers::getLoopIds();
   for (int i = 0; i < names.size(); ++i)
-    loopSelector.addItem(names[i], i + 1);
+    loopSelector.addItem(names[i], ids[i]);
   //
-  loopSelector.setSelectedId(1);
+  currentLoopId = audioProcessor.getSelectedLoop();
+  loopSelector.setSelectedId(currentLoopId, juce::dontSendNotification);
   loopSelector.onChange = [this]
   {
     currentLoopId = loopSelector.getSelectedId();
+    audioProcessor.setSelectedLoop(currentLoopId);
+
+    // The rendered audio belongs to the old loop: stop rendering it and don't
+    // offer it for dragging until the new one is generated
+    cancelAudioRender();
+    audioLoopComponent->setEnabled(false);
   };
 
   // ——— Generate buttons ———
@@ -42,6 +107,7 @@ JBProducerAudioProcessorEditor::JBProducerAudioProcessorEditor(JBProducerAudioPr
   audioLoopComponent.reset(new DraggableLoopComponent("Audio Loop", juce::Colours::green.withAlpha(0.6f)));
   addAndMakeVisible(midiLoopComponent.get());
   addAndMakeVisible(audioLoopComponent.get());
+  addChildComponent(renderProgressBar);
 
   // — Preview button —
   addAndMakeVisible(previewButton);
@@ -53,24 +119,23 @@ JBProducerAudioProcessorEditor::JBProducerAudioProcessorEditor(JBProducerAudioPr
   stopButton.onClick = [this]
   { stopPreview(); };
 
-  // — Audio playback setup —
-  deviceManager.initialise(
-      /* numInputChannels  */ 0,
-      /* numOutputChannels */ 2,
-      /* xmlState           */ nullptr,
-      /* selectDefaultDevice*/ true);
-  deviceManager.addAudioCallback(&audioPlayer);
-  audioPlayer.setSource(&transportSource);
+  // Live loop toggle
+  addAndMakeVisible(liveLoopToggle);
+  liveLoopToggle.setToggleState(audioProcessor.isLiveLoopEnabled(), juce::dontSendNotification);
+  liveLoopToggle.onClick = [this]
+  { audioProcessor.setLiveLoopEnabled(liveLoopToggle.getToggleState()); };
 
   setSize(500, 400);
 }
 
 JBProducerAudioProcessorEditor::~JBProducerAudioProcessorEditor()
 {
-  // teardown audio playback
-  audioPlayer.setSource(nullptr);
-  deviceManager.removeAudioCallback(&audioPlayer);
-  transportSource.setSource(nullptr);
+  // a running render must finish before the editor goes away
+  ++renderGeneration;
+  renderPool.removeAllJobs(true, 5000);
+
+  // stop the preview with the editor, as before
+  stopPreview();
 }
 
 //==============================================================================
@@ -94,6 +159,9 @@ void JBProducerAudioProcessorEditor::resized()
 
   y += 30 + pad;
 
+  liveLoopToggle.setBounds(pad, y, getWidth() - 2 * pad, 25);
+  y += 25 + pad;
+
   // Buttons:
   int btnW = (getWidth() - 3 * pad) / 2;
   generateMidiButton.setBounds(pad, y, btnW, 30);
@@ -105,6 +173,7 @@ void JBProducerAudioProcessorEditor::resized()
   int halfW = (getWidth() - 3 * pad) / 2;
   midiLoopComponent->setBounds(pad, y, halfW, dragH);
   audioLoopComponent->setBounds(2 * pad + halfW, y, halfW, dragH);
+  renderProgressBar.setBounds(audioLoopComponent->getBounds().withSizeKeepingCentre(halfW - 2 * pad, 20));
 }
 
 void JBProducerAudioProcessorEditor::generateMidiLoop()
@@ -116,37 +185,117 @@ void JBProducerAudioProcessorEditor::generateMidiLoop()
 
 void JBProducerAudioProcessorEditor::generateAudioLoop()
 {
-  auto bpm = audioProcessor.getHostBPM();
-  auto sr = audioProcessor.getSampleRate() < 8000 ? 44100.0 : audioProcessor.getSampleRate();
-  auto block = LoopDataHelpers::makeAudioBlock(currentLoopId,
-                                               bpm,
-                                               2,
-                                               sr);
-  audioLoopComponent->setLoopData(block, "wav");
+  startAudioRender(false);
 }
+
 void JBProducerAudioProcessorEditor::previewAudio()
 {
-  transportSource.stop();
-  transportSource.setSource(nullptr);
-  transportReaderSource.reset();
+  startAudioRender(true);
+}
+
+void JBProducerAudioProcessorEditor::startAudioRender(bool thenPreview)
+{
+  previewWhenRendered = previewWhenRendered || thenPreview;
+
+  // The render already running is for the selected loop, but the tempo or rate
+  // may have changed since it started: check again once it's done
+  if (renderPending)
+  {
+    renderRequestedWhilePending = true;
+    return;
+  }
+
   auto bpm = audioProcessor.getHostBPM();
-  double sr = audioProcessor.getSampleRate() < 8000 ? 44100.0
-                                                    : audioProcessor.getSampleRate();
-  auto block = LoopDataHelpers::makeAudioBlock(currentLoopId,
-                                               bpm,
-                                               /* channels */ 2,
-                                               sr);
-  auto *memStream = new juce::MemoryInputStream(block, /* keepInternalCopy */ false);
-
-  juce::WavAudioFormat wavFormat;
-  if (auto *reader = wavFormat.createReaderFor(memStream, /* deleteStreamWhenDone */ true))
+  auto sr = getRenderSampleRate();
+
+  // Nothing changed since the last render: reuse it
+  if (isCurrentRender(lastRender.get()))
   {
-    transportReaderSource.reset(new juce::AudioFormatReaderSource(reader, /* takeOwnership */ true));
-    transportSource.setSource(transportReaderSource.get(),
-                              /* readAheadBufferSize */ 0,
-                              nullptr,
-                              sr);
-    transportSource.setPosition(0.0);
-    transportSource.start();
+    audioLoopComponent->setEnabled(true);
+    if (previewWhenRendered)
+    {
+      previewWhenRendered = false;
+      playPreview();
+    }
+    return;
   }
+
+  auto generation = ++renderGeneration;
+
+  juce::Component::SafePointer<JBProducerAudioProcessorEditor> safeThis(this);
+  renderPool.addJob(new LoopRenderJob(currentLoopId, bpm, sr,
+                                      [safeThis, generation](std::shared_ptr<RenderedLoop> loop)
+                                      {
+                                        if (safeThis != nullptr)
+                                          safeThis->audioRenderFinished(generation, std::move(loop));
+                                      }),
+                    /* deleteJobWhenFinished */ true);
+
+  renderPending = true;
+  setRendering(true);
+}
+
+void JBProducerAudioProcessorEditor::cancelAudioRender()
+{
+  // Anything still on its way back is from an older generation and gets dropped
+  ++renderGeneration;
+  renderPool.removeAllJobs(/* interruptRunningJobs */ true, /* timeOutMs */ 0);
+
+  renderPending = false;
+  renderRequestedWhilePending = false;
+  previewWhenRendered = false;
+  setRendering(false);
+}
+
+void JBProducerAudioProcessorEditor::audioRenderFinished(int generation, std::shared_ptr<RenderedLoop> loop)
+{
+  if (generation != renderGeneration)
+    return;
+
+  renderPending = false;
+  setRendering(false);
+
+  lastRender = std::move(loop);
+
+  // Asked for again meanwhile, with settings this render doesn't match: render again
+  if (std::exchange(renderRequestedWhilePending, false) && !isCurrentRender(lastRender.get()))
+  {
+    startAudioRender(false);
+    return;
+  }
+
+  audioLoopComponent->setLoopData(lastRender->wav, "wav");
+  audioLoopComponent->setEnabled(true);
+
+  if (previewWhenRendered)
+  {
+    previewWhenRendered = false;
+    playPreview();
+  }
+}
+
+double JBProducerAudioProcessorEditor::getRenderSampleRate() const
+{
+  return audioProcessor.getSampleRate() < 8000 ? 44100.0 : audioProcessor.getSampleRate();
+}
+
+bool JBProducerAudioProcessorEditor::isCurrentRender(const RenderedLoop *loop) const
+{
+  return loop != nullptr && loop->loopId == currentLoopId && loop->bpm == audioProcessor.getHostBPM() && loop->sampleRate == getRenderSampleRate();
+}
+
+void JBProducerAudioProcessorEditor::setRendering(bool isRendering)
+{
+  renderProgressBar.setVisible(isRendering);
+  generateAudioButton.setButtonText(isRendering ? "Rendering..." : "Generate Audio Loop");
+  if (isRendering)
+    audioLoopComponent->setEnabled(false);
+}
+
+void JBProducerAudioProcessorEditor::playPreview()
+{
+  // Hand the rendered buffer to the processor, which loops it in processBlock in
+  // time with the host. The aliasing pointer keeps the whole render alive.
+  audioProcessor.getPreviewPlayer().play(PreviewPlayer::Audio(lastRender, &lastRender->audio),
+                                         lastRender->lengthInBeats);
 }
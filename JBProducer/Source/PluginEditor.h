@@ -10,7 +10,6 @@
 
 #include <JuceHeader.h>
 #include "PluginProcessor.h"
-#include "Service/DraggableLoopComponent.h"
 
 //==============================================================================
 /**
@@ -41,18 +40,47 @@ private:
   juce::TextButton previewButton{"Preview"};
   juce::TextButton stopButton{"Stop"};
 
-  // Audio playback in the editor
-  juce::AudioDeviceManager deviceManager;
-  juce::AudioSourcePlayer audioPlayer;
-  juce::AudioTransportSource transportSource;
-  std::unique_ptr<juce::AudioFormatReaderSource> transportReaderSource;
+  // Plays the selected loop live from the processor, in time with the host
+  juce::ToggleButton liveLoopToggle{"Play with host transport"};
+
+  // A rendered audio loop and the settings it was rendered with
+  struct RenderedLoop
+  {
+    int loopId;
+    float bpm;
+    double sampleRate;
+    double lengthInBeats; // of the longest layer
+    juce::AudioBuffer<float> audio;
+    juce::MemoryBlock wav;
+  };
+
+  class LoopRenderJob;
+
+  // Audio loops render on a background thread; results from cancelled renders
+  // are recognised by their generation and dropped
+  juce::ThreadPool renderPool{1};
+  int renderGeneration = 0;
+  bool renderPending = false;
+  bool renderRequestedWhilePending = false;
+  bool previewWhenRendered = false;
+  std::shared_ptr<RenderedLoop> lastRender;
+  double renderProgress = -1.0; // indeterminate
+  juce::ProgressBar renderProgressBar{renderProgress};
 
   int currentLoopId = 1;
 
   void generateMidiLoop();
   void generateAudioLoop();
   void previewAudio();
-  void stopPreview() { transportSource.stop(); }
+  void stopPreview() { audioProcessor.getPreviewPlayer().stop(); }
+
+  void startAudioRender(bool thenPreview);
+  void cancelAudioRender();
+  void audioRenderFinished(int generation, std::shared_ptr<RenderedLoop> loop);
+  double getRenderSampleRate() const;
+  bool isCurrentRender(const RenderedLoop *loop) const;
+  void setRendering(bool isRendering);
+  void playPreview();
 
   JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(JBProducerAudioProcessorEditor)
 };
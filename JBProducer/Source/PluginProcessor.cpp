@@ -8,6 +8,7 @@
 
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
+#include "LoopDataHelpers.h"
 
 //==============================================================================
 JBProducerAudioProcessor::JBProducerAudioProcessor()
@@ -23,6 +24,20 @@ JBProducerAudioProcessor::JBProducerAudioProcessor()
 #endif
 
 {
+    // Hand every loop to the sequencer up front, so processBlock never has to decode
+    for (auto &ld : LoopDataHelpers::allLoops)
+        std::visit([this](auto &d)
+                   { loopSequencer.addPattern(d.index, RhythmGenerator::toPattern(d.loop), d.sample, d.sampleSize); }, ld);
+
+    // A kit is each of its layers added under the kit's id, so they all play together
+    for (auto &kit : LoopDataHelpers::allKits)
+        for (int layerId : kit.layers)
+            std::visit([&](auto &d)
+                       { loopSequencer.addPattern(kit.index, RhythmGenerator::toPattern(d.loop), d.sample, d.sampleSize); },
+                       LoopDataHelpers::getLoopById(layerId));
+
+    loopSequencer.setPattern(std::visit([](auto &d)
+                                        { return d.index; }, LoopDataHelpers::allLoops.front()));
 }
 
 JBProducerAudioProcessor::~JBProducerAudioProcessor()
@@ -94,8 +109,7 @@ void JBProducerAudioProcessor::changeProgramName(int index, const juce::String &
 //==============================================================================
 void JBProducerAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
-    // Use this method as the place to do any pre-playback
-    // initialisation that you need..
+    loopSequencer.prepare(sampleRate);
 }
 
 void JBProducerAudioProcessor::releaseResources()
@@ -131,20 +145,23 @@ bool JBProducerAudioProcessor::isBusesLayoutSupported(const BusesLayout &layouts
 
 void JBProducerAudioProcessor::processBlock(juce::AudioBuffer<float> &buffer, juce::MidiBuffer &midiMessages)
 {
-    // retrieve host BPM (or keep default 120)
+    juce::Optional<juce::AudioPlayHead::PositionInfo> pos;
     if (auto *playHead = getPlayHead())
+        pos = playHead->getPosition();
+
+    // retrieve host BPM (or keep default 120)
+    if (pos)
     {
-        if (auto pos = playHead->getPosition())
+        if (auto tmp = pos->getBpm(); tmp.hasValue())
         {
-            if (auto tmp = pos->getBpm(); tmp.hasValue())
-            {
-                mHostBPM = (int)*tmp;
-            }
+            mHostBPM = (int)*tmp;
         }
     }
 
-    // Clear the buffer to ensure silence
+    // Clear the buffer, then add the live loop and the loop preview (if any) on top
     buffer.clear();
+    loopSequencer.process(buffer, pos ? &*pos : nullptr);
+    previewPlayer.process(buffer, pos ? &*pos : nullptr);
 }
 
 //==============================================================================
@@ -9,6 +9,8 @@
 #pragma once
 
 #include <JuceHeader.h>
+#include "Service/PreviewPlayer.h"
+#include "Service/LoopSequencer.h"
 
 //==============================================================================
 /**
@@ -55,8 +57,19 @@ public:
 
   float getHostBPM() const { return mHostBPM; }
 
+  // Loop preview, played through this processor's output
+  PreviewPlayer &getPreviewPlayer() { return previewPlayer; }
+
+  // Live loop playback, locked to the host transport
+  void setSelectedLoop(int loopId) { loopSequencer.setPattern(loopId); }
+  int getSelectedLoop() const { return loopSequencer.getPattern(); }
+  void setLiveLoopEnabled(bool shouldPlay) { loopSequencer.setEnabled(shouldPlay); }
+  bool isLiveLoopEnabled() const { return loopSequencer.isEnabled(); }
+
 private:
   float mHostBPM{120.f};
+  PreviewPlayer previewPlayer;
+  LoopSequencer loopSequencer;
   //==============================================================================
   JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(JBProducerAudioProcessor)
 };
@@ -0,0 +1,289 @@
+#pragma once
+#include <JuceHeader.h>
+#include <array>
+#include <atomic>
+#include <vector>
+
+/**
+    LoopSequencer: plays loop patterns live from processBlock, locked to the host.
+
+    Each block, the host's ppq position and tempo decide which notes of the selected
+    pattern start inside the block and at which sample, once the pattern's swing and
+    the groove have moved them off the grid; every note then starts a voice from a
+    fixed pool at exactly that offset. Notes are mixed with the same hit renderer,
+    gain and fade-out as MidiToAudio, so what you hear in the arrangement is what a
+    drag-and-drop render would contain.
+
+    Patterns are added and their samples decoded and repitched up front (addPattern),
+    so the audio thread never allocates, decodes or locks. Patterns added under the
+    same id play together, which is how the layers of a kit are played.
+*/
+class LoopSequencer
+{
+public:
+    static constexpr int numVoices = 16;
+
+    /** Adds a pattern that can then be selected by its id. Message thread only, before playback.
+        Adding several patterns with the same id layers them. The groove's offsets are
+        drawn here, in the same order as MidiToAudio::prepareHits, so each loop round
+        plays the same take as a render with that groove. */
+    void addPattern(int id, const RhythmGenerator::Pattern &notes, const void *sampleData, size_t sampleDataSize,
+                    const MidiToAudio::Groove &groove = {})
+    {
+        const int numSteps = notes.getNumSteps();
+        if (numSteps <= 0)
+            return;
+
+        Pattern pattern;
+        pattern.id = id;
+        pattern.stepsPerBeat = notes.stepsPerBeat;
+        pattern.maxTimingOffsetSeconds = std::abs(groove.timingMs) * 0.001;
+
+        const auto sample = SampleLoopGenerator::getDecodedSample(sampleData, sampleDataSize);
+
+        juce::Random random(groove.seed);
+        for (const auto &note : notes.notes)
+        {
+            // Draw for every note, even skipped ones, to stay in step with the offline render
+            const double timingOffset = pattern.maxTimingOffsetSeconds * (2.0 * random.nextDouble() - 1.0);
+            const float humanise = 1.0f + groove.velocity * (2.0f * random.nextFloat() - 1.0f);
+
+            Event event;
+            event.startStep = note.startStep;
+            event.position = notes.getStepPosition(note.startStep);
+            event.lengthSteps = notes.getStepPosition(note.startStep + note.lengthSteps) - event.position;
+            event.timingOffsetSeconds = timingOffset;
+            event.gain = juce::jmax(0.0f, MidiToAudio::velocityToGain(note.velocity) * humanise);
+
+            if (!juce::isPositiveAndBelow(note.startStep, numSteps) || event.lengthSteps <= 0.0
+                || event.gain <= 0.0f || sample->getNumChannels() == 0)
+                continue;
+
+            event.sample = SampleLoopGenerator::getRepitchedSample(sample, MidiNoteHandler::midiNoteToFrequency(note.midiNote));
+            pattern.events.push_back(std::move(event));
+        }
+
+        // A list of notes per step, so the audio thread finds a step's notes without searching
+        pattern.eventsAtStep.resize((size_t)numSteps);
+        for (size_t i = 0; i < pattern.events.size(); ++i)
+            pattern.eventsAtStep[(size_t)pattern.events[i].startStep].push_back((int)i);
+
+        patterns.push_back(std::move(pattern));
+    }
+
+    void prepare(double newSampleRate)
+    {
+        sampleRate = newSampleRate;
+        reset();
+    }
+
+    void reset()
+    {
+        for (auto &voice : voices)
+            voice.active = false;
+        for (auto &voice : fadingVoices)
+            voice.active = false;
+        for (auto &pattern : patterns)
+            pattern.playing = false;
+    }
+
+    /** Selects the pattern to play by id (0 for none). Safe from any thread. */
+    void setPattern(int id) { selectedId.store(id); }
+    int getPattern() const { return selectedId.load(); }
+
+    void setEnabled(bool shouldPlay) { enabled.store(shouldPlay); }
+    bool isEnabled() const { return enabled.load(); }
+
+    /** Adds this block's notes to buffer. Audio thread only. */
+    void process(juce::AudioBuffer<float> &buffer, const juce::AudioPlayHead::PositionInfo *hostPosition)
+    {
+        const int numSamples = buffer.getNumSamples();
+        const int id = selectedId.load();
+        const bool hostPlaying = enabled.load() && hostPosition != nullptr && hostPosition->getIsPlaying();
+
+        for (auto &pattern : patterns)
+        {
+            if (hostPlaying && pattern.id == id)
+            {
+                auto ppq = hostPosition->getPpqPosition();
+                auto bpm = hostPosition->getBpm();
+                if (ppq.hasValue() && bpm.hasValue() && *bpm > 0.0)
+                    triggerSteps(pattern, *ppq, *bpm, numSamples);
+            }
+            else
+            {
+                // Let sounding notes ring out, but start afresh when the transport restarts
+                pattern.playing = false;
+            }
+        }
+
+        for (auto &voice : voices)
+            if (voice.active)
+                renderVoice(voice, buffer);
+        for (auto &voice : fadingVoices)
+            if (voice.active)
+                renderVoice(voice, buffer);
+    }
+
+private:
+    struct Event
+    {
+        int startStep = 0;
+        double position = 0.0;    // where the note falls once swung, in steps from the start of the loop
+        double lengthSteps = 0.0; // swung length
+        double timingOffsetSeconds = 0.0;
+        float gain = 0.0f;
+        SampleLoopGenerator::RepitchedSample sample;
+    };
+
+    struct Pattern
+    {
+        int id = 0;
+        int stepsPerBeat = 2;
+        double maxTimingOffsetSeconds = 0.0;
+        std::vector<Event> events;
+        std::vector<std::vector<int>> eventsAtStep;
+
+        // Owned by the audio thread: how far into the song this pattern has been played
+        bool playing = false;
+        double playedUntil = 0.0;
+    };
+
+    struct Voice
+    {
+        bool active = false;
+        const juce::AudioBuffer<float> *sample = nullptr; // already repitched
+        int delay = 0;  // samples into the next block before the note starts
+        int played = 0; // samples rendered so far
+        int length = 0; // total note length, including the fade
+        int fadeSamples = 0;
+        float gain = 0.0f;
+        juce::uint32 age = 0;
+    };
+
+    void triggerSteps(Pattern &pattern, double ppq, double bpm, int numSamples)
+    {
+        const auto stepsPerLoop = (juce::int64)pattern.eventsAtStep.size();
+        if (stepsPerLoop == 0 || pattern.stepsPerBeat <= 0)
+            return;
+
+        const double stepsPerSecond = bpm / 60.0 * pattern.stepsPerBeat;
+        const double samplesPerStep = sampleRate / stepsPerSecond;
+
+        // The span of the song (in steps from its start) that this block covers
+        const double firstStep = ppq * pattern.stepsPerBeat;
+        const double endStep = firstStep + numSamples / samplesPerStep;
+
+        // Carry on exactly where the last block stopped, so a note on a block boundary
+        // plays once; start afresh if the host jumped
+        const bool continuing = pattern.playing && std::abs(firstStep - pattern.playedUntil) < 1.0;
+        const double from = continuing ? pattern.playedUntil : firstStep;
+        pattern.playing = true;
+        pattern.playedUntil = endStep;
+
+        // Swing moves a note up to a third of a step late; the groove either way
+        const auto margin = 1 + (juce::int64)std::ceil(pattern.maxTimingOffsetSeconds * stepsPerSecond);
+        const int maxLength = (int)samplesPerStep;
+
+        for (auto step = (juce::int64)std::floor(from) - margin; step < endStep + margin; ++step)
+        {
+            const auto loopStep = ((step % stepsPerLoop) + stepsPerLoop) % stepsPerLoop;
+
+            for (int eventIndex : pattern.eventsAtStep[(size_t)loopStep])
+            {
+                const auto &event = pattern.events[(size_t)eventIndex];
+                const double position = (double)step + (event.position - event.startStep)
+                                        + event.timingOffsetSeconds * stepsPerSecond;
+                if (position < from || position >= endStep)
+                    continue;
+
+                const int offset = juce::jlimit(0, numSamples - 1, (int)((position - firstStep) * samplesPerStep));
+                startVoice(event, offset, juce::jmin((int)(event.lengthSteps * samplesPerStep), maxLength));
+            }
+        }
+    }
+
+    void startVoice(const Event &event, int offset, int length)
+    {
+        if (length <= 0)
+            return;
+
+        // Take a free voice, or steal the oldest one
+        Voice *voice = &voices[0];
+        for (auto &v : voices)
+        {
+            if (!v.active)
+            {
+                voice = &v;
+                break;
+            }
+            if (v.age < voice->age)
+                voice = &v;
+        }
+
+        if (voice->active)
+            fadeOut(*voice);
+
+        voice->active = true;
+        voice->sample = event.sample.get();
+        voice->delay = offset;
+        voice->played = 0;
+        voice->length = length;
+        voice->fadeSamples = juce::jmin(length, (int)(sampleRate * MidiToAudio::hitFadeSeconds));
+        voice->gain = event.gain;
+        voice->age = ++voiceCounter;
+    }
+
+    /** Hands a stolen voice to a slot of its own for a short fade, so it doesn't click off. */
+    void fadeOut(const Voice &stolen)
+    {
+        // Nothing has sounded yet
+        if (stolen.played == 0)
+            return;
+
+        Voice *slot = &fadingVoices[0];
+        for (auto &v : fadingVoices)
+        {
+            if (!v.active)
+            {
+                slot = &v;
+                break;
+            }
+            if (v.age < slot->age)
+                slot = &v;
+        }
+
+        const int remaining = juce::jmin(stolen.length, stolen.sample->getNumSamples()) - stolen.played;
+        const int fade = juce::jmin(remaining, (int)(sampleRate * MidiToAudio::hitFadeSeconds));
+
+        *slot = stolen;
+        slot->length = stolen.played + fade;
+        slot->fadeSamples = fade;
+        slot->active = fade > 0;
+    }
+
+    void renderVoice(Voice &voice, juce::AudioBuffer<float> &buffer)
+    {
+        const int numSamples = buffer.getNumSamples();
+        const int start = juce::jmin(voice.delay, numSamples);
+        voice.delay -= start;
+
+        // Place the hit so the next unplayed sample lands at start; only this block's part is mixed
+        SampleLoopGenerator::addRepitchedHit(buffer, start - voice.played, voice.length,
+                                             *voice.sample, voice.fadeSamples, voice.gain);
+
+        voice.played += numSamples - start;
+        if (voice.played >= juce::jmin(voice.length, voice.sample->getNumSamples()))
+            voice.active = false;
+    }
+
+    std::vector<Pattern> patterns;
+    std::array<Voice, numVoices> voices{};
+    std::array<Voice, numVoices> fadingVoices{};
+    juce::uint32 voiceCounter = 0;
+    double sampleRate = 44100.0;
+    std::atomic<int> selectedId{0};
+    std::atomic<bool> enabled{false};
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LoopSequencer)
+};
@@ -0,0 +1,140 @@
+#pragma once
+#include <JuceHeader.h>
+#include <atomic>
+#include <memory>
+
+/**
+    PreviewPlayer: plays a rendered loop from the plugin's own processBlock.
+
+    The message thread hands a loop over with play() and the audio thread picks it
+    up at the start of its next block with a single atomic exchange, so neither side
+    ever waits on a lock. Loops the audio thread has finished with go onto a lock-free
+    list that the message thread empties, so they're never released on the audio
+    thread, and the audio thread can always take the latest loop.
+
+    The loop always plays at its own speed. When the host transport starts (or a new
+    loop arrives while it's playing) the position is lined up with the host's beat
+    position, using the loop's own length in beats; from there it free-runs, so a
+    host tempo that differs from the render's never makes it jump.
+*/
+class PreviewPlayer
+{
+public:
+    using Audio = std::shared_ptr<const juce::AudioBuffer<float>>;
+
+    PreviewPlayer() = default;
+
+    ~PreviewPlayer()
+    {
+        delete pending.exchange(nullptr);
+        releaseRetired();
+        delete current;
+    }
+
+    /** Starts looping audio, lengthInBeats long. Call from the message thread. */
+    void play(Audio audio, double lengthInBeats)
+    {
+        publish(new Loop{std::move(audio), lengthInBeats});
+    }
+
+    /** Stops the preview. Call from the message thread. */
+    void stop()
+    {
+        publish(new Loop{});
+    }
+
+    /** Adds the preview to buffer. Call from the audio thread. */
+    void process(juce::AudioBuffer<float> &buffer, const juce::AudioPlayHead::PositionInfo *hostPosition)
+    {
+        if (auto *next = pending.exchange(nullptr))
+        {
+            // Hand the old loop back instead of freeing it here
+            if (current != nullptr)
+                retire(current);
+            current = next;
+            position = 0;
+            synced = false;
+        }
+
+        const bool hostPlaying = hostPosition != nullptr && hostPosition->getIsPlaying();
+        if (!hostPlaying)
+            synced = false;
+
+        if (current == nullptr || current->audio == nullptr)
+            return;
+
+        const auto &audio = *current->audio;
+        const int length = audio.getNumSamples();
+        const int srcChannels = audio.getNumChannels();
+        if (length == 0 || srcChannels == 0)
+            return;
+
+        if (hostPlaying && !synced && current->lengthInBeats > 0.0)
+        {
+            if (auto ppq = hostPosition->getPpqPosition())
+            {
+                const double beat = std::fmod(*ppq, current->lengthInBeats);
+                position = (int)((beat < 0.0 ? beat + current->lengthInBeats : beat) * length / current->lengthInBeats);
+                position = juce::jlimit(0, length - 1, position);
+                synced = true;
+            }
+        }
+
+        for (int offset = 0; offset < buffer.getNumSamples();)
+        {
+            const int n = juce::jmin(buffer.getNumSamples() - offset, length - position);
+
+            for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+                buffer.addFrom(ch, offset, audio, juce::jmin(ch, srcChannels - 1), position, n);
+
+            offset += n;
+            position += n;
+            if (position >= length)
+                position = 0;
+        }
+    }
+
+private:
+    struct Loop
+    {
+        Audio audio;
+        double lengthInBeats = 0.0;
+        Loop *nextRetired = nullptr;
+    };
+
+    void publish(Loop *loop)
+    {
+        // Anything the audio thread handed back, or never picked up, is freed here
+        releaseRetired();
+        delete pending.exchange(loop);
+    }
+
+    // Audio thread: pushes a loop onto the retired list. Only the message thread
+    // removes entries, and only all of them at once, so a plain CAS push is safe.
+    void retire(Loop *loop)
+    {
+        loop->nextRetired = retired.load();
+        while (!retired.compare_exchange_weak(loop->nextRetired, loop))
+        {
+        }
+    }
+
+    // Message thread: frees every loop the audio thread has handed back
+    void releaseRetired()
+    {
+        for (auto *loop = retired.exchange(nullptr); loop != nullptr;)
+        {
+            auto *next = loop->nextRetired;
+            delete loop;
+            loop = next;
+        }
+    }
+
+    std::atomic<Loop *> pending{nullptr}; // message thread -> audio thread
+    std::atomic<Loop *> retired{nullptr}; // audio thread -> message thread, a list through nextRetired
+    Loop *current = nullptr;              // owned by the audio thread
+    int position = 0;
+    bool synced = false; // lined up with the host since its transport started
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PreviewPlayer)
+};
@@ -0,0 +1,252 @@
+/*
+  ==============================================================================
+
+    This file contains the basic startup code for a JUCE application.
+
+    Renders every loop and kit in JBProducer's LoopDataHelpers at a set of
+    tempos and sample rates and writes the WAV and MIDI files to disk, spread
+    over a thread pool. Usage:
+
+        LoopBatchExporter <outputFolder> [--bpm=90,120,140] [--rates=44100,48000] [--bits=24] [--threads=8] [--generate=100]
+
+    --bits picks the WAV format: 16 or 24-bit integer, or 32-bit float. WAV files
+    are encoded straight to disk while they render, a block at a time.
+
+    --generate also writes that many patterns from RhythmGenerator::generatePattern
+    (seeds 1 to N, default settings) as MIDI files at each tempo, in a Generated folder.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include <atomic>
+#include "../../JBProducer/Source/LoopDataHelpers.h"
+
+namespace
+{
+    const juce::String defaultTempos = "80,90,100,120,140,160";
+    const juce::String defaultSampleRates = "44100,48000,96000";
+    const juce::String defaultBitDepth = "16";
+    const juce::String defaultNumGenerated = "0";
+
+    // Running totals shared by all export jobs
+    struct ExportStats
+    {
+        std::atomic<int> filesWritten{0};
+        std::atomic<int> failures{0};
+        std::atomic<juce::int64> bytesWritten{0};
+    };
+
+    // "90,120,140" -> {90, 120, 140}, skipping anything that isn't a positive number
+    juce::Array<double> parseList(const juce::String &text)
+    {
+        juce::StringArray tokens;
+        tokens.addTokens(text, ",", {});
+
+        juce::Array<double> values;
+        for (auto &token : tokens)
+            if (auto value = token.trim().getDoubleValue(); value > 0.0)
+                values.add(value);
+
+        return values;
+    }
+
+    //==============================================================================
+    // Renders one loop at one tempo and sample rate. The MIDI file doesn't depend
+    // on the sample rate, so only the job for the first rate writes it.
+    class ExportJob : public juce::ThreadPoolJob
+    {
+    public:
+        ExportJob(int loopId, float bpm, double sampleRate, int bitsPerSample, bool writeMidi,
+                  juce::File folder, ExportStats &stats)
+            : juce::ThreadPoolJob("Loop export"),
+              loopId(loopId), bpm(bpm), sampleRate(sampleRate), bitsPerSample(bitsPerSample),
+              writeMidi(writeMidi), folder(std::move(folder)), stats(stats)
+        {
+        }
+
+        JobStatus runJob() override
+        {
+            auto baseName = folder.getFileName() + " " + juce::String(bpm, 0) + "bpm";
+
+            auto wavFile = folder.getChildFile(baseName + " " + juce::String((int)sampleRate) + "Hz.wav");
+            if (LoopDataHelpers::writeAudioFile(loopId, wavFile, bpm, 2, sampleRate, bitsPerSample))
+                written(wavFile.getSize());
+            else
+                failed(wavFile);
+
+            if (writeMidi)
+                write(folder.getChildFile(baseName + ".mid"), LoopDataHelpers::makeMidiBlock(loopId, bpm));
+
+            return jobHasFinished;
+        }
+
+    private:
+        void write(const juce::File &file, const juce::MemoryBlock &data)
+        {
+            if (data.getSize() > 0 && file.replaceWithData(data.getData(), data.getSize()))
+                written((juce::int64)data.getSize());
+            else
+                failed(file);
+        }
+
+        void written(juce::int64 numBytes)
+        {
+            ++stats.filesWritten;
+            stats.bytesWritten += numBytes;
+        }
+
+        void failed(const juce::File &file)
+        {
+            ++stats.failures;
+            std::cerr << "Failed to write " << file.getFullPathName() << std::endl;
+        }
+
+        int loopId;
+        float bpm;
+        double sampleRate;
+        int bitsPerSample;
+        bool writeMidi;
+        juce::File folder;
+        ExportStats &stats;
+    };
+}
+
+//==============================================================================
+int main(int argc, char *argv[])
+{
+    juce::ArgumentList args(argc, argv);
+
+    juce::File outputFolder;
+    for (auto &arg : args.arguments)
+        if (!arg.isOption())
+            outputFolder = arg.resolveAsFile();
+
+    if (outputFolder == juce::File() || args.containsOption("--help|-h"))
+    {
+        std::cout << "Usage: " << args.executableName
+                  << " <outputFolder> [--bpm=" << defaultTempos
+                  << "] [--rates=" << defaultSampleRates
+                  << "] [--bits=" << defaultBitDepth
+                  << "] [--threads=" << juce::SystemStats::getNumCpus()
+                  << "] [--generate=" << defaultNumGenerated << "]" << std::endl;
+        return outputFolder == juce::File() ? 1 : 0;
+    }
+
+    auto optionOr = [&](const char *option, const juce::String &fallback)
+    {
+        auto value = args.getValueForOption(option);
+        return value.isEmpty() ? fallback : value;
+    };
+
+    auto tempos = parseList(optionOr("--bpm", defaultTempos));
+    auto sampleRates = parseList(optionOr("--rates", defaultSampleRates));
+    auto bitsPerSample = optionOr("--bits", defaultBitDepth).getIntValue();
+    auto numThreads = juce::jmax(1, optionOr("--threads", juce::String(juce::SystemStats::getNumCpus())).getIntValue());
+    auto numGenerated = juce::jmax(0, optionOr("--generate", defaultNumGenerated).getIntValue());
+
+    if (bitsPerSample != 16 && bitsPerSample != 24 && bitsPerSample != 32)
+    {
+        std::cerr << "--bits must be 16, 24 or 32 (float)" << std::endl;
+        return 1;
+    }
+
+    if (tempos.isEmpty() || sampleRates.isEmpty())
+    {
+        std::cerr << "Nothing to export: give at least one tempo and one sample rate" << std::endl;
+        return 1;
+    }
+
+    ExportStats stats;
+    juce::ThreadPool pool(numThreads);
+    double audioSeconds = 0.0;
+    int numRenders = 0;
+
+    const auto startMs = juce::Time::getMillisecondCounterHiRes();
+
+    const auto loopIds = LoopDataHelpers::getLoopIds();
+    const auto loopNames = LoopDataHelpers::getLoopNames();
+
+    // One folder per loop, created up front so the jobs only ever write files
+    for (int l = 0; l < loopIds.size(); ++l)
+    {
+        const int loopId = loopIds[l];
+        auto folder = outputFolder.getChildFile(juce::File::createLegalFileName(loopNames[l]));
+        if (!folder.createDirectory())
+        {
+            std::cerr << "Can't create " << folder.getFullPathName() << std::endl;
+            return 1;
+        }
+
+        for (auto bpm : tempos)
+        {
+            for (int i = 0; i < sampleRates.size(); ++i)
+            {
+                pool.addJob(new ExportJob(loopId, (float)bpm, sampleRates[i], bitsPerSample, i == 0, folder, stats),
+                            /* deleteJobWhenFinished */ true);
+                audioSeconds += LoopDataHelpers::kBeatsPerLoop * 60.0 / bpm;
+                ++numRenders;
+            }
+        }
+    }
+
+    // Generated patterns: one MIDI file per seed and tempo, each cheap enough to write in one job
+    if (numGenerated > 0)
+    {
+        auto folder = outputFolder.getChildFile("Generated");
+        if (!folder.createDirectory())
+        {
+            std::cerr << "Can't create " << folder.getFullPathName() << std::endl;
+            return 1;
+        }
+
+        for (auto bpm : tempos)
+            pool.addJob([folder, bpm, numGenerated, &stats]
+                        {
+                            RhythmGenerator::Pattern pattern;
+                            for (int seed = 1; seed <= numGenerated; ++seed)
+                            {
+                                RhythmGenerator::generatePattern({}, seed, pattern);
+                                auto data = RhythmGenerator::createMIDISequence(pattern, (float)bpm);
+                                auto file = folder.getChildFile("Generated " + juce::String(seed) + " " + juce::String(bpm, 0) + "bpm.mid");
+
+                                if (data.getSize() > 0 && file.replaceWithData(data.getData(), data.getSize()))
+                                {
+                                    ++stats.filesWritten;
+                                    stats.bytesWritten += (juce::int64)data.getSize();
+                                }
+                                else
+                                {
+                                    ++stats.failures;
+                                    std::cerr << "Failed to write " << file.getFullPathName() << std::endl;
+                                }
+                            }
+                        });
+    }
+
+    std::cout << "Exporting " << numRenders << " renders (" << loopIds.size() << " loops x "
+              << tempos.size() << " tempos x " << sampleRates.size() << " sample rates) on "
+              << numThreads << " threads to " << outputFolder.getFullPathName() << std::endl;
+
+    if (numGenerated > 0)
+        std::cout << "and " << numGenerated * tempos.size() << " generated MIDI patterns" << std::endl;
+
+    while (pool.getNumJobs() > 0)
+        juce::Thread::sleep(20);
+
+    const auto seconds = (juce::Time::getMillisecondCounterHiRes() - startMs) / 1000.0;
+
+    std::cout << "Wrote " << stats.filesWritten.load() << " files ("
+              << juce::File::descriptionOfSizeInBytes(stats.bytesWritten.load()) << ") in "
+              << juce::String(seconds, 2) << " s: "
+              << juce::String(numRenders / seconds, 1) << " renders/s, "
+              << juce::String(audioSeconds / seconds, 1) << "x realtime" << std::endl;
+
+    if (stats.failures.load() > 0)
+    {
+        std::cerr << stats.failures.load() << " files failed" << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -1,7 +1,5 @@
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
-#include "Service/MidiLoopGenerator.h"
-#include "Service/AudioLoopGenerator.h"
 
 LoopGeneratorAudioProcessorEditor::LoopGeneratorAudioProcessorEditor(LoopGeneratorAudioProcessor &p,
                                                                      juce::AudioProcessorValueTreeState &params)
@@ -37,6 +35,7 @@ void LoopGeneratorAudioProcessorEditor::setupSliders()
   addAndMakeVisible(bpmSlider);
   addAndMakeVisible(waveformSelector);
   addAndMakeVisible(frequencySlider);
+  addAndMakeVisible(liveModeToggle);
 
   // Configure sliders
   numBarsSlider.setSliderStyle(juce::Slider::SliderStyle::RotaryVerticalDrag);
@@ -79,6 +78,9 @@ void LoopGeneratorAudioProcessorEditor::setupSliders()
 
   frequencyAttachment.reset(new juce::AudioProcessorValueTreeState::SliderAttachment(
       parameters, "frequency", frequencySlider));
+
+  liveModeAttachment.reset(new juce::AudioProcessorValueTreeState::ButtonAttachment(
+      parameters, "liveMode", liveModeToggle));
 }
 
 void LoopGeneratorAudioProcessorEditor::paint(juce::Graphics &g)
@@ -157,6 +159,8 @@ void LoopGeneratorAudioProcessorEditor::resized()
   {
     auto bpmArea = area.removeFromTop(60);
     bpmLabel.setBounds(bpmArea.removeFromTop(labelH));
+    liveModeToggle.setBounds(bpmArea.removeFromRight(100).withSizeKeepingCentre(100, 25));
+    bpmArea.removeFromLeft(100);
     int x = bpmArea.getX() + (bpmArea.getWidth() - sliderW) / 2;
     bpmSlider.setBounds(x, bpmArea.getY(), sliderW, 40);
   }
@@ -226,7 +230,7 @@ void LoopGeneratorAudioProcessorEditor::generateAudioLoop()
                                                                              );
 
   // Create WAV file
-  juce::MemoryBlock wavFileData = AudioLoopGenerator::createWavFile(audioLoop, sampleRate);
+  juce::MemoryBlock wavFileData = WavWriter::createWavFile(audioLoop, sampleRate);
 
   // Update draggable component
   audioLoopComponent->setLoopData(wavFileData, "wav");
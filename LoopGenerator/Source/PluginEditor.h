@@ -2,7 +2,6 @@
 
 #include <JuceHeader.h>
 #include "PluginProcessor.h"
-#include "Service/DraggableLoopComponent.h"
 
 class LoopGeneratorAudioProcessorEditor : public juce::AudioProcessorEditor,
                                           public juce::DragAndDropContainer
@@ -28,6 +27,7 @@ private:
   juce::Slider bpmSlider;
   juce::ComboBox waveformSelector;
   juce::Slider frequencySlider;
+  juce::ToggleButton liveModeToggle{"Play Live"};
 
   // Labels
   juce::Label numBarsLabel{"", "Number of Bars:"};
@@ -46,6 +46,7 @@ private:
   std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> bpmAttachment;
   std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> waveformAttachment;
   std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> frequencyAttachment;
+  std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> liveModeAttachment;
 
   void setupSliders();
   void generateMidiLoop();
@@ -7,6 +7,12 @@ LoopGeneratorAudioProcessor::LoopGeneratorAudioProcessor()
                          .withOutput("Output", juce::AudioChannelSet::stereo(), true)),
       parameters(*this, nullptr, "Parameters", createParameters())
 {
+    numBarsParam = parameters.getRawParameterValue("numBars");
+    beatsPerBarParam = parameters.getRawParameterValue("beatsPerBar");
+    bpmParam = parameters.getRawParameterValue("bpm");
+    waveformParam = parameters.getRawParameterValue("waveform");
+    frequencyParam = parameters.getRawParameterValue("frequency");
+    liveModeParam = parameters.getRawParameterValue("liveMode");
 }
 
 LoopGeneratorAudioProcessor::~LoopGeneratorAudioProcessor()
@@ -26,13 +32,19 @@ juce::AudioProcessorValueTreeState::ParameterLayout LoopGeneratorAudioProcessor:
     params.push_back(std::make_unique<juce::AudioParameterChoice>(juce::ParameterID("waveform", 4), "Waveform",
                                                                   juce::StringArray("Sine", "Square", "Saw", "Triangle"), 0));
     params.push_back(std::make_unique<juce::AudioParameterFloat>(juce::ParameterID("frequency", 5), "Frequency", 20.0f, 20000.0f, 440.0f));
+    params.push_back(std::make_unique<juce::AudioParameterBool>(juce::ParameterID("liveMode", 6), "Play Live", false));
 
     return {params.begin(), params.end()};
 }
 
 void LoopGeneratorAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
-    // Nothing to prepare for this specific plugin
+    // Glide frequency changes over 50ms so moving the slider doesn't click
+    frequency.reset(sampleRate, 0.05);
+    frequency.setCurrentAndTargetValue(*frequencyParam);
+    oscillator.reset();
+    nextLoopSample = 0;
+    wasPlaying = false;
 }
 
 void LoopGeneratorAudioProcessor::releaseResources()
@@ -42,9 +54,74 @@ void LoopGeneratorAudioProcessor::releaseResources()
 
 void LoopGeneratorAudioProcessor::processBlock(juce::AudioBuffer<float> &buffer, juce::MidiBuffer &midiMessages)
 {
-    // This plugin doesn't process audio in real-time - it generates loops on demand
-    // Clear the buffer to ensure silence
+    juce::ScopedNoDenormals noDenormals;
+
+    // Loops are generated on demand; only live mode plays anything here
     buffer.clear();
+    if (*liveModeParam < 0.5f)
+    {
+        wasPlaying = false;
+        return;
+    }
+
+    const int numSamples = buffer.getNumSamples();
+    const double sampleRate = getSampleRate();
+    const double loopBeats = static_cast<int>(*numBarsParam) * static_cast<int>(*beatsPerBarParam);
+
+    // Follow the host's tempo and position while its transport runs. Without a
+    // position (e.g. standalone) the loop free-runs at the BPM parameter.
+    double bpm = *bpmParam;
+    juce::Optional<double> beatsIntoLoop;
+    if (auto *playHead = getPlayHead())
+    {
+        if (auto pos = playHead->getPosition())
+        {
+            if (!pos->getIsPlaying())
+            {
+                wasPlaying = false;
+                return;
+            }
+
+            if (auto hostBpm = pos->getBpm(); hostBpm.hasValue() && *hostBpm > 0.0)
+                bpm = *hostBpm;
+
+            if (auto ppq = pos->getPpqPosition())
+                beatsIntoLoop = std::fmod(juce::jmax(0.0, *ppq), loopBeats);
+        }
+    }
+
+    const double samplesPerBeat = sampleRate * 60.0 / bpm;
+    const auto loopLength = juce::jmax<juce::int64>(1, static_cast<juce::int64>(loopBeats * samplesPerBeat));
+    auto loopSample = beatsIntoLoop ? static_cast<juce::int64>(std::llround(*beatsIntoLoop * samplesPerBeat))
+                                    : nextLoopSample % loopLength;
+
+    // Carry straight on from the last block unless the host jumped; then restart
+    // the oscillator where the rendered loop would be at that point
+    frequency.setTargetValue(*frequencyParam);
+    if (wasPlaying && std::abs(loopSample - nextLoopSample) <= 1)
+        loopSample = nextLoopSample;
+    else
+        oscillator.reset(std::fmod(loopSample / sampleRate * frequency.getCurrentValue(), 1.0));
+
+    // Render one channel, stepping the frequency glide every 32 samples
+    oscillator.setWaveform(static_cast<int>(*waveformParam));
+    float *channelData = buffer.getWritePointer(0);
+    for (int i = 0; i < numSamples;)
+    {
+        const int n = frequency.isSmoothing() ? juce::jmin(32, numSamples - i) : numSamples - i;
+        oscillator.setFrequency(frequency.skip(n), sampleRate);
+        oscillator.process(channelData + i, n);
+        i += n;
+    }
+    AudioLoopGenerator::applyBeatEnvelope(channelData, numSamples, loopSample, sampleRate, static_cast<float>(bpm));
+
+    for (int channel = 1; channel < buffer.getNumChannels(); ++channel)
+        buffer.copyFrom(channel, 0, buffer, 0, 0, numSamples);
+
+    nextLoopSample = loopSample + numSamples;
+    if (nextLoopSample >= loopLength)
+        nextLoopSample -= loopLength;
+    wasPlaying = true;
 }
 
 juce::AudioProcessorEditor *LoopGeneratorAudioProcessor::createEditor()
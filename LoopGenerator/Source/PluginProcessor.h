@@ -36,5 +36,18 @@ public:
 private:
   juce::AudioProcessorValueTreeState::ParameterLayout createParameters();
 
+  // Live mode: plays the loop through processBlock, in time with the host
+  std::atomic<float> *numBarsParam = nullptr;
+  std::atomic<float> *beatsPerBarParam = nullptr;
+  std::atomic<float> *bpmParam = nullptr;
+  std::atomic<float> *waveformParam = nullptr;
+  std::atomic<float> *frequencyParam = nullptr;
+  std::atomic<float> *liveModeParam = nullptr;
+
+  AudioLoopGenerator::Oscillator oscillator;
+  juce::SmoothedValue<float, juce::ValueSmoothingTypes::Multiplicative> frequency;
+  juce::int64 nextLoopSample = 0; // where the next block starts, if nothing jumps
+  bool wasPlaying = false;
+
   JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(LoopGeneratorAudioProcessor)
 };
\ No newline at end of file
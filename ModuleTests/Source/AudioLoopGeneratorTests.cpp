@@ -0,0 +1,122 @@
+#include "Reference.h"
+#include "TestSamples.h"
+#include <vector>
+
+class AudioLoopGeneratorTests : public juce::UnitTest
+{
+public:
+    AudioLoopGeneratorTests() : juce::UnitTest("AudioLoopGenerator", "Loop tools") {}
+
+    void runTest() override
+    {
+        constexpr double sampleRate = 44100.0;
+        constexpr float bpm = 120.0f;
+        constexpr int length = (int)(2 * sampleRate);
+        constexpr float frequency = 440.0f;
+
+        beginTest("The sine and the envelope match the fmod renderer");
+        {
+            const auto audio = AudioLoopGenerator::generateAudioLoop(frequency, length, sampleRate, bpm, 0, 2);
+            const auto reference = Reference::generateAudioLoop(frequency, length, sampleRate, bpm, 0, 2);
+            expectLessThan(TestSamples::maxDifference(audio, reference), 1.0e-4f);
+        }
+
+        beginTest("Square, saw and triangle only differ from the naive waveforms at their edges");
+        {
+            const double cycles = length * frequency / sampleRate;
+
+            for (int waveformType : {1, 2, 3})
+            {
+                const auto audio = AudioLoopGenerator::generateAudioLoop(frequency, length, sampleRate, bpm, waveformType, 1);
+                const auto reference = Reference::generateAudioLoop(frequency, length, sampleRate, bpm, waveformType, 1);
+
+                int differing = 0;
+                for (int i = 0; i < length; ++i)
+                    if (std::abs(audio.getSample(0, i) - reference.getSample(0, i)) > 1.0e-3f)
+                        ++differing;
+
+                // The correction touches the sample either side of each edge (the saw has one per cycle)
+                const int edgesPerCycle = waveformType == 2 ? 1 : 2;
+                expectLessOrEqual(differing, 2 * edgesPerCycle * (int)std::ceil(cycles), "waveform " + juce::String(waveformType));
+            }
+        }
+
+        beginTest("Band-limiting cuts the aliasing");
+        {
+            // High enough that the naive waveforms' harmonics fold back well into the audible range
+            constexpr double highFrequency = 3520.0;
+            constexpr int numSamples = 32768;
+
+            for (int waveformType : {1, 2, 3})
+            {
+                std::vector<float> bandLimited((size_t)numSamples), naive((size_t)numSamples);
+
+                AudioLoopGenerator::Oscillator oscillator;
+                oscillator.setWaveform(waveformType);
+                oscillator.setFrequency(highFrequency, sampleRate);
+                oscillator.process(bandLimited.data(), numSamples);
+
+                for (int i = 0; i < numSamples; ++i)
+                    naive[(size_t)i] = Reference::naiveWaveform(waveformType, std::fmod(i * highFrequency / sampleRate, 1.0));
+
+                const double aliasing = inharmonicEnergyDb(bandLimited, highFrequency, sampleRate);
+                const double naiveAliasing = inharmonicEnergyDb(naive, highFrequency, sampleRate);
+                logMessage("waveform " + juce::String(waveformType) + ": " + juce::String(aliasing, 1) + " dB aliased, naive "
+                           + juce::String(naiveAliasing, 1) + " dB");
+
+                // PolyBLEP takes about 15 dB off the square and saw; the triangle's aliasing is low to begin with
+                const double requiredGain = waveformType == 3 ? 2.0 : 10.0;
+                expectLessThan(aliasing, naiveAliasing - requiredGain, "waveform " + juce::String(waveformType));
+            }
+        }
+    }
+
+private:
+    /**
+     * Energy left in signal once its DC and every harmonic of frequency below
+     * Nyquist are taken out, relative to the whole signal, in dB. For a periodic
+     * waveform that is what aliasing has folded in between the harmonics.
+     */
+    static double inharmonicEnergyDb(const std::vector<float> &signal, double frequency, double sampleRate)
+    {
+        const auto n = signal.size();
+        std::vector<double> residual(signal.begin(), signal.end());
+
+        double mean = 0.0;
+        for (auto x : residual)
+            mean += x;
+        mean /= (double)n;
+
+        double total = 0.0;
+        for (auto &x : residual)
+        {
+            x -= mean;
+            total += x * x;
+        }
+
+        for (int harmonic = 1; harmonic * frequency < sampleRate / 2; ++harmonic)
+        {
+            const double w = juce::MathConstants<double>::twoPi * harmonic * frequency / sampleRate;
+
+            double c = 0.0, s = 0.0;
+            for (size_t i = 0; i < n; ++i)
+            {
+                c += residual[i] * std::cos(w * (double)i);
+                s += residual[i] * std::sin(w * (double)i);
+            }
+            c *= 2.0 / (double)n;
+            s *= 2.0 / (double)n;
+
+            for (size_t i = 0; i < n; ++i)
+                residual[i] -= c * std::cos(w * (double)i) + s * std::sin(w * (double)i);
+        }
+
+        double remaining = 0.0;
+        for (auto x : residual)
+            remaining += x * x;
+
+        return 10.0 * std::log10(remaining / total);
+    }
+};
+
+static AudioLoopGeneratorTests audioLoopGeneratorTests;
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <JuceHeader.h>
+
+namespace Benchmark
+{
+    /** Benchmarks go in this category; they only run when ModuleTests is given --bench. */
+    inline const juce::String category = "Benchmarks";
+
+    /** Written to by benchmarks so the optimiser can't drop the work being timed. */
+    inline volatile float sink = 0.0f;
+
+    /**
+     * Runs fn once to warm up caches, then repeatedly for at least minSeconds,
+     * and returns the mean time per run in seconds.
+     */
+    template <typename Fn>
+    double secondsPerRun(Fn &&fn, double minSeconds = 0.25)
+    {
+        fn();
+
+        int runs = 0;
+        double elapsed = 0.0;
+        const auto startMs = juce::Time::getMillisecondCounterHiRes();
+
+        do
+        {
+            fn();
+            ++runs;
+            elapsed = (juce::Time::getMillisecondCounterHiRes() - startMs) / 1000.0;
+        } while (elapsed < minSeconds);
+
+        return elapsed / runs;
+    }
+}
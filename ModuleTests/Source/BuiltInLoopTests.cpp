@@ -0,0 +1,34 @@
+#include "Reference.h"
+#include "TestSamples.h"
+#include "../../JBProducer/Source/LoopDataHelpers.h"
+
+class BuiltInLoopTests : public juce::UnitTest
+{
+public:
+    BuiltInLoopTests() : juce::UnitTest("Built-in loops", "Loop tools") {}
+
+    void runTest() override
+    {
+        constexpr float bpm = 120.0f;
+        constexpr double sampleRate = 44100.0;
+
+        beginTest("Every built-in loop renders at the level it always had");
+        {
+            for (const auto &loopData : LoopDataHelpers::allLoops)
+            {
+                const auto pattern = LoopDataHelpers::getPattern(loopData);
+                const auto [sample, sampleSize, name] = std::visit([](auto &d)
+                                                                   { return std::make_tuple(d.sample, d.sampleSize, juce::String(d.name)); }, loopData);
+
+                const auto audio = MidiToAudio::convert(pattern, sample, sampleSize, bpm, 2, sampleRate);
+                const auto baseline = Reference::convert(pattern, sample, sampleSize, bpm, 2, sampleRate);
+
+                expectWithinAbsoluteError(audio.getMagnitude(0, audio.getNumSamples()),
+                                          baseline.getMagnitude(0, baseline.getNumSamples()), 1.0e-4f, name);
+                expectLessThan(TestSamples::maxDifference(audio, baseline), 1.0e-4f, name);
+            }
+        }
+    }
+};
+
+static BuiltInLoopTests builtInLoopTests;
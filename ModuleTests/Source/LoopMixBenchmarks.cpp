@@ -0,0 +1,59 @@
+#include "Benchmark.h"
+#include "Reference.h"
+#include "TestSamples.h"
+#include "../../JBProducer/Source/LoopDataHelpers.h"
+
+class LoopMixBenchmarks : public juce::UnitTest
+{
+public:
+    LoopMixBenchmarks() : juce::UnitTest("Loop mixing", Benchmark::category) {}
+
+    void runTest() override
+    {
+        constexpr float bpm = 120.0f;
+        constexpr int numChannels = 2;
+
+        beginTest("In place against per-note buffers, all built-in loops");
+        {
+            for (double sampleRate : {44100.0, 96000.0})
+            {
+                double inPlaceTotal = 0.0, perNoteTotal = 0.0;
+
+                for (const auto &loopData : LoopDataHelpers::allLoops)
+                {
+                    const auto pattern = LoopDataHelpers::getPattern(loopData);
+                    const auto [sample, sampleSize] = std::visit([](auto &d)
+                                                                 { return std::make_pair(d.sample, d.sampleSize); }, loopData);
+
+                    juce::AudioBuffer<float> inPlace, perNote;
+
+                    auto mixInPlace = [&]
+                    {
+                        inPlace = MidiToAudio::convert(pattern, sample, sampleSize, bpm, numChannels, sampleRate);
+                        Benchmark::sink = inPlace.getSample(0, 0);
+                    };
+
+                    auto mixPerNote = [&]
+                    {
+                        perNote = Reference::convert(pattern, sample, sampleSize, bpm, numChannels, sampleRate);
+                        Benchmark::sink = perNote.getSample(0, 0);
+                    };
+
+                    inPlaceTotal += Benchmark::secondsPerRun(mixInPlace, 0.05);
+                    perNoteTotal += Benchmark::secondsPerRun(mixPerNote, 0.05);
+
+                    // Both paths must still render the same loop
+                    expectLessThan(TestSamples::maxDifference(inPlace, perNote), 1.0e-4f,
+                                   std::visit([](auto &d)
+                                              { return d.name; }, loopData));
+                }
+
+                logMessage(juce::String((int)sampleRate) + " Hz, " + juce::String(LoopDataHelpers::kNumLoops) + " loops: in place "
+                           + juce::String(inPlaceTotal * 1000.0, 3) + " ms, per-note buffers " + juce::String(perNoteTotal * 1000.0, 3)
+                           + " ms (" + juce::String(perNoteTotal / inPlaceTotal, 2) + "x)");
+            }
+        }
+    }
+};
+
+static LoopMixBenchmarks loopMixBenchmarks;
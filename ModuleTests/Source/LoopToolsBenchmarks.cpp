@@ -0,0 +1,199 @@
+#include "Benchmark.h"
+#include "Reference.h"
+#include "TestSamples.h"
+
+class LoopToolsBenchmarks : public juce::UnitTest
+{
+public:
+    LoopToolsBenchmarks() : juce::UnitTest("Loop tools", Benchmark::category) {}
+
+    void runTest() override
+    {
+        constexpr float bpm = 120.0f;
+        const auto &tone = TestSamples::getToneWav();
+
+        // Every 16th of 4 bars, over a few pitches
+        RhythmGenerator::Pattern busy;
+        for (int step = 0; step < busy.getNumSteps(); ++step)
+            busy.notes.push_back({step, 1, 36 + (step % 4) * 5, 0.8f});
+
+        const double loopSeconds = busy.getNumBeats() * 60.0 / bpm;
+
+        beginTest("MidiToAudio renders");
+        {
+            for (double sampleRate : {44100.0, 96000.0})
+            {
+                auto convert = [&]
+                {
+                    auto audio = MidiToAudio::convert(busy, tone.getData(), tone.getSize(), bpm, 2, sampleRate);
+                    Benchmark::sink = audio.getSample(0, 0);
+                };
+
+                const auto seconds = Benchmark::secondsPerRun(convert);
+                logMessage("convert at " + juce::String((int)sampleRate) + " Hz: " + juce::String(seconds * 1000.0, 3)
+                           + " ms per loop, " + juce::String(loopSeconds / seconds, 0) + "x realtime");
+            }
+
+            auto stream = [&]
+            {
+                juce::MemoryBlock wav;
+                MidiToAudio::writeWavFile(std::make_unique<juce::MemoryOutputStream>(wav, false),
+                                          busy, tone.getData(), tone.getSize(), bpm, 2, 44100.0, 24);
+                Benchmark::sink = (float)wav.getSize();
+            };
+
+            const auto seconds = Benchmark::secondsPerRun(stream);
+            logMessage("writeWavFile, 24-bit: " + juce::String(seconds * 1000.0, 3) + " ms per loop, "
+                       + juce::String(loopSeconds / seconds, 0) + "x realtime");
+        }
+
+        beginTest("WavWriter encodes");
+        {
+            // Ten seconds of stereo at 44.1 kHz
+            const auto audio = MidiToAudio::convert(busy, tone.getData(), tone.getSize(), 96.0f, 2, 44100.0);
+            const double audioSeconds = audio.getNumSamples() / 44100.0;
+
+            for (int bits : {16, 24, 32})
+            {
+                auto encode = [&]
+                { Benchmark::sink = (float)WavWriter::createWavFile(audio, 44100.0, bits).getSize(); };
+
+                logMessage(juce::String(bits) + "-bit: " + juce::String(audioSeconds / Benchmark::secondsPerRun(encode), 0) + "x realtime");
+            }
+        }
+
+        beginTest("PatternGenerator");
+        {
+            // 16ths and 8th triplets over 4 bars, reusing one Pattern as the generator is meant to be used
+            for (int stepsPerBeat : {4, 3})
+            {
+                RhythmGenerator::GeneratorSettings settings;
+                settings.stepsPerBeat = stepsPerBeat;
+                settings.sustain = 0.2f;
+
+                RhythmGenerator::Pattern pattern;
+                juce::int64 seed = 0;
+
+                auto generate = [&]
+                {
+                    RhythmGenerator::generatePattern(settings, ++seed, pattern);
+                    Benchmark::sink = (float)pattern.notes.size();
+                };
+
+                logMessage(juce::String(stepsPerBeat) + " steps per beat: "
+                           + juce::String(1.0 / Benchmark::secondsPerRun(generate), 0) + " patterns/s");
+            }
+        }
+
+        beginTest("Reading notes from a Loop16 and a StepPattern");
+        {
+            RhythmGenerator::Loop16 loop{};
+            for (auto *bar : {&loop.bar_1, &loop.bar_2, &loop.bar_3, &loop.bar_4})
+                for (int i = 0; i < 16; ++i)
+                    bar->notes[i] = {i % 3 == 2 ? RhythmGenerator::Continuation : RhythmGenerator::Note, 0.8f, MidiNoteHandler::C3};
+
+            const auto packed = RhythmGenerator::toStepPattern(loop);
+            std::vector<RhythmGenerator::NoteEvent> events;
+
+            auto readLoop = [&]
+            {
+                RhythmGenerator::collectNoteEvents(loop, events);
+                Benchmark::sink = (float)events.size();
+            };
+
+            auto readPacked = [&]
+            {
+                RhythmGenerator::collectNoteEvents(packed, events);
+                Benchmark::sink = (float)events.size();
+            };
+
+            logMessage("Loop16 (" + juce::String((int)sizeof(loop)) + " bytes): "
+                       + juce::String(Benchmark::secondsPerRun(readLoop) * 1.0e9, 0) + " ns");
+            logMessage("PackedLoop16 (" + juce::String((int)sizeof(packed)) + " bytes): "
+                       + juce::String(Benchmark::secondsPerRun(readPacked) * 1.0e9, 0) + " ns");
+        }
+
+        beginTest("AudioLoopGenerator against the fmod renderer");
+        {
+            // An 8 second stereo loop at 44.1 kHz
+            constexpr double sampleRate = 44100.0;
+            constexpr int length = (int)(8 * sampleRate);
+            const char *const names[] = {"sine", "square", "saw", "triangle"};
+
+            for (int waveformType = 0; waveformType < 4; ++waveformType)
+            {
+                auto generate = [&]
+                {
+                    auto audio = AudioLoopGenerator::generateAudioLoop(440.0f, length, sampleRate, bpm, waveformType, 2);
+                    Benchmark::sink = audio.getSample(1, length - 1);
+                };
+
+                auto generateReference = [&]
+                {
+                    auto audio = Reference::generateAudioLoop(440.0f, length, sampleRate, bpm, waveformType, 2);
+                    Benchmark::sink = audio.getSample(1, length - 1);
+                };
+
+                const auto seconds = Benchmark::secondsPerRun(generate);
+                const auto referenceSeconds = Benchmark::secondsPerRun(generateReference);
+                logMessage(juce::String(names[waveformType]) + ": " + juce::String(seconds * 1000.0, 2) + " ms, fmod "
+                           + juce::String(referenceSeconds * 1000.0, 2) + " ms (" + juce::String(referenceSeconds / seconds, 1) + "x)");
+            }
+        }
+
+        beginTest("MidiNoteHandler tables against pow and log2");
+        {
+            // Every MIDI note, and a sweep of frequencies over the audible range
+            std::vector<int> notes;
+            for (int midiNote = 0; midiNote < 128; ++midiNote)
+                notes.push_back(midiNote);
+
+            std::vector<float> frequencies;
+            for (float frequency = 20.0f; frequency < 20000.0f; frequency *= 1.01f)
+                frequencies.push_back(frequency);
+
+            auto tableFrequencies = [&]
+            {
+                float sum = 0.0f;
+                for (int note : notes)
+                    sum += MidiNoteHandler::midiNoteToFrequency(note);
+                Benchmark::sink = sum;
+            };
+
+            auto powFrequencies = [&]
+            {
+                float sum = 0.0f;
+                for (int note : notes)
+                    sum += Reference::midiNoteToFrequency(note);
+                Benchmark::sink = sum;
+            };
+
+            auto tableNotes = [&]
+            {
+                int sum = 0;
+                for (float frequency : frequencies)
+                    sum += MidiNoteHandler::frequencyToMidiNote(frequency);
+                Benchmark::sink = (float)sum;
+            };
+
+            auto log2Notes = [&]
+            {
+                int sum = 0;
+                for (float frequency : frequencies)
+                    sum += Reference::frequencyToMidiNote(frequency);
+                Benchmark::sink = (float)sum;
+            };
+
+            // Nanoseconds per call
+            const auto tableFrequency = Benchmark::secondsPerRun(tableFrequencies) / (double)notes.size() * 1.0e9;
+            const auto powFrequency = Benchmark::secondsPerRun(powFrequencies) / (double)notes.size() * 1.0e9;
+            const auto tableNote = Benchmark::secondsPerRun(tableNotes) / (double)frequencies.size() * 1.0e9;
+            const auto log2Note = Benchmark::secondsPerRun(log2Notes) / (double)frequencies.size() * 1.0e9;
+
+            logMessage("midiNoteToFrequency: " + juce::String(tableFrequency, 2) + " ns, pow " + juce::String(powFrequency, 2) + " ns");
+            logMessage("frequencyToMidiNote: " + juce::String(tableNote, 2) + " ns, log2 " + juce::String(log2Note, 2) + " ns");
+        }
+    }
+};
+
+static LoopToolsBenchmarks loopToolsBenchmarks;
@@ -0,0 +1,49 @@
+/*
+  ==============================================================================
+
+    This file contains the basic startup code for a JUCE application.
+
+    Runs the unit tests of the shared JBlanked modules, or with --bench the
+    benchmarks, which print their timings instead. Usage:
+
+        ModuleTests [--bench] [--seed=<n>]
+
+    --seed replays a run of the randomised tests; every run logs its seed.
+    Exits with 1 if any test failed.
+
+  ==============================================================================
+*/
+
+#include <JuceHeader.h>
+#include "Benchmark.h"
+
+//==============================================================================
+int main(int argc, char *argv[])
+{
+    juce::ArgumentList args(argc, argv);
+
+    if (args.containsOption("--help|-h"))
+    {
+        std::cout << "Usage: " << args.executableName << " [--bench] [--seed=<n>]" << std::endl;
+        return 0;
+    }
+
+    // 0 picks a random seed
+    const auto seed = args.getValueForOption("--seed").getLargeIntValue();
+    const bool benchmarks = args.containsOption("--bench");
+
+    juce::Array<juce::UnitTest *> tests;
+    for (auto *test : juce::UnitTest::getAllTests())
+        if ((test->getCategory() == Benchmark::category) == benchmarks)
+            tests.add(test);
+
+    juce::UnitTestRunner runner;
+    runner.setAssertOnFailure(false);
+    runner.runTests(tests, seed);
+
+    int failures = 0;
+    for (int i = 0; i < runner.getNumResults(); ++i)
+        failures += runner.getResult(i)->failures;
+
+    return failures > 0 ? 1 : 0;
+}
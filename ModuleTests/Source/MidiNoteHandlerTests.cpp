@@ -0,0 +1,71 @@
+#include "Reference.h"
+#include <cmath>
+#include <vector>
+
+class MidiNoteHandlerTests : public juce::UnitTest
+{
+public:
+    MidiNoteHandlerTests() : juce::UnitTest("MidiNoteHandler", "Loop tools") {}
+
+    void runTest() override
+    {
+        using namespace MidiNoteHandler;
+
+        beginTest("Every NoteName maps to the switch's MIDI number");
+        {
+            for (int i = 0; i < numNoteNames; ++i)
+                expectEquals(noteToMidiNote(static_cast<NoteName>(i)), computeMidiNote(static_cast<NoteName>(i)));
+
+            expectEquals(noteToMidiNote(C3), 48);
+            expectEquals(noteToMidiNote(A9), -1);
+        }
+
+        beginTest("The frequency table matches pow for all 128 notes");
+        {
+            for (int midiNote = 0; midiNote < 128; ++midiNote)
+            {
+                const float expected = Reference::midiNoteToFrequency(midiNote);
+                expectWithinAbsoluteError(midiNoteToFrequency(midiNote), expected, expected * 1.0e-6f,
+                                          "MIDI note " + juce::String(midiNote));
+            }
+
+            expectEquals(midiNoteToFrequency(69), 440.0f);
+            expectEquals(midiNoteToFrequency(-1), 0.0f);
+            expectEquals(midiNoteToFrequency(128), 0.0f);
+        }
+
+        beginTest("frequencyToMidiNote and frequencyToNote match log2 at the note boundaries");
+        {
+            for (float frequency : getTestFrequencies())
+            {
+                const auto message = juce::String(frequency, 6) + " Hz";
+                expectEquals(frequencyToMidiNote(frequency), Reference::frequencyToMidiNote(frequency), message);
+                expectEquals((int)frequencyToNote(frequency), (int)Reference::frequencyToNote(frequency), message);
+            }
+        }
+    }
+
+    /**
+     * Each note's own frequency, the floats either side of every boundary
+     * between neighbouring notes, and frequencies far outside the MIDI range.
+     */
+    static std::vector<float> getTestFrequencies()
+    {
+        std::vector<float> frequencies{-440.0f, 0.0f, 1.0e-3f, 0.5f, 8.0f, 20000.0f, 1.0e6f};
+
+        for (int midiNote = 0; midiNote < 128; ++midiNote)
+            frequencies.push_back(MidiNoteHandler::midiNoteToFrequency(midiNote));
+
+        for (double boundary : MidiNoteHandler::midiNoteBoundaryTable)
+        {
+            const auto nearest = static_cast<float>(boundary);
+            frequencies.push_back(nearest);
+            frequencies.push_back(std::nextafter(nearest, 0.0f));
+            frequencies.push_back(std::nextafter(nearest, 1.0e9f));
+        }
+
+        return frequencies;
+    }
+};
+
+static MidiNoteHandlerTests midiNoteHandlerTests;
@@ -0,0 +1,149 @@
+#include "TestSamples.h"
+
+class MidiToAudioTests : public juce::UnitTest
+{
+public:
+    MidiToAudioTests() : juce::UnitTest("MidiToAudio", "Loop tools") {}
+
+    void runTest() override
+    {
+        const auto pattern = makePattern();
+
+        beginTest("convert renders the whole loop");
+        {
+            auto audio = render(pattern);
+            expectEquals(audio.getNumChannels(), 2);
+            expectEquals(audio.getNumSamples(), samplesPerBeat * pattern.getNumBeats());
+            expect(audio.getMagnitude(0, 0, audio.getNumSamples()) > 0.0f);
+        }
+
+        beginTest("An empty pattern renders silence");
+        {
+            RhythmGenerator::Pattern empty;
+            auto audio = render(empty);
+            expectEquals(audio.getNumSamples(), samplesPerBeat * empty.getNumBeats());
+            expectEquals(audio.getMagnitude(0, 0, audio.getNumSamples()), 0.0f);
+        }
+
+        beginTest("Hits start on their step and stop within it");
+        {
+            auto audio = render(singleNote(5));
+            const int start = (int)(5 * samplesPerStep);
+            expectEquals(audio.getMagnitude(0, 0, start), 0.0f);
+            expect(audio.getMagnitude(0, start, 256) > 0.0f);
+            expectEquals(audio.getMagnitude(0, start + maxHitLength, samplesPerBeat), 0.0f);
+        }
+
+        beginTest("Swing delays the off steps");
+        {
+            auto swung = singleNote(1);
+            swung.swing = 1.0f;
+            auto audio = render(swung);
+
+            // At full swing step 1 lands a third of a step late
+            const int start = (int)((1.0 + 1.0 / 3.0) * samplesPerStep);
+            expectEquals(audio.getMagnitude(0, 0, start), 0.0f);
+            expect(audio.getMagnitude(0, start, 256) > 0.0f);
+        }
+
+        beginTest("Rendering a block at a time matches one pass");
+        {
+            const auto whole = render(pattern);
+            for (int blockSize : {64, 1000, WavWriter::streamBlockSize})
+                expectWithinAbsoluteError(TestSamples::maxDifference(renderInBlocks(pattern, blockSize), whole),
+                                          0.0f, 1.0e-6f, "block size " + juce::String(blockSize));
+        }
+
+        beginTest("Velocity scales each hit");
+        {
+            auto soft = singleNote(5);
+            soft.notes[0].velocity = 0.5f;
+            const auto loud = render(singleNote(5));
+            const int start = (int)(5 * samplesPerStep);
+
+            expectWithinAbsoluteError(render(soft).getMagnitude(0, start, maxHitLength),
+                                      0.5f * loud.getMagnitude(0, start, maxHitLength), 1.0e-6f);
+        }
+
+        beginTest("A groove sounds the same whatever the block size");
+        {
+            const MidiToAudio::Groove groove{10.0, 0.3f, 42};
+            const auto whole = render(pattern, groove);
+            expect(TestSamples::maxDifference(whole, render(pattern)) > 0.0f);
+
+            for (int blockSize : {64, 1000, WavWriter::streamBlockSize})
+                expectWithinAbsoluteError(TestSamples::maxDifference(renderInBlocks(pattern, blockSize, groove), whole),
+                                          0.0f, 1.0e-6f, "block size " + juce::String(blockSize));
+        }
+
+        beginTest("Each groove seed is another take");
+        {
+            const MidiToAudio::Groove take1{10.0, 0.3f, 1}, take2{10.0, 0.3f, 2};
+            expectEquals(TestSamples::maxDifference(render(pattern, take1), render(pattern, take1)), 0.0f);
+            expect(TestSamples::maxDifference(render(pattern, take1), render(pattern, take2)) > 0.0f);
+        }
+
+        beginTest("writeWavFile streams the same audio as convert");
+        {
+            const auto &tone = TestSamples::getToneWav();
+            juce::MemoryBlock streamed;
+            expect(MidiToAudio::writeWavFile(std::make_unique<juce::MemoryOutputStream>(streamed, false),
+                                             pattern, tone.getData(), tone.getSize(), bpm, 2, sampleRate, 32));
+
+            expectWithinAbsoluteError(TestSamples::maxDifference(TestSamples::decodeWav(streamed), render(pattern)),
+                                      0.0f, 1.0e-6f);
+        }
+    }
+
+private:
+    static constexpr float bpm = 120.0f;
+    static constexpr double sampleRate = TestSamples::sampleRate;
+    static constexpr int samplesPerBeat = 22050;                  // what convert works out for 120 bpm
+    static constexpr double samplesPerStep = samplesPerBeat / 4.0; // 16ths
+    static constexpr int maxHitLength = samplesPerBeat / 4;
+
+    // 4 bars of 16ths, with a held note, a note running to the loop's end and a few pitches
+    static RhythmGenerator::Pattern makePattern()
+    {
+        RhythmGenerator::Pattern pattern;
+        pattern.notes = {{0, 1, 48, 1.0f}, {3, 2, 55, 0.8f}, {8, 1, 36, 0.6f}, {30, 4, 48, 0.9f}, {63, 1, 60, 0.5f}};
+        return pattern;
+    }
+
+    static RhythmGenerator::Pattern singleNote(int step)
+    {
+        RhythmGenerator::Pattern pattern;
+        pattern.notes = {{step, 1, 48, 1.0f}};
+        return pattern;
+    }
+
+    static juce::AudioBuffer<float> render(const RhythmGenerator::Pattern &pattern, const MidiToAudio::Groove &groove = {})
+    {
+        const auto &tone = TestSamples::getToneWav();
+        return MidiToAudio::convert(pattern, tone.getData(), tone.getSize(), bpm, 2, sampleRate, groove);
+    }
+
+    static juce::AudioBuffer<float> renderInBlocks(const RhythmGenerator::Pattern &pattern, int blockSize,
+                                                   const MidiToAudio::Groove &groove = {})
+    {
+        const auto &tone = TestSamples::getToneWav();
+        const auto hits = MidiToAudio::prepareHits(pattern, tone.getData(), tone.getSize(), bpm, sampleRate, groove);
+        juce::AudioBuffer<float> whole(2, samplesPerBeat * pattern.getNumBeats());
+        juce::AudioBuffer<float> block;
+
+        for (int blockStart = 0; blockStart < whole.getNumSamples(); blockStart += blockSize)
+        {
+            const int numSamples = juce::jmin(blockSize, whole.getNumSamples() - blockStart);
+            block.setSize(2, numSamples, false, false, true);
+            block.clear();
+            MidiToAudio::addToBuffer(block, blockStart, hits);
+
+            for (int ch = 0; ch < 2; ++ch)
+                whole.copyFrom(ch, blockStart, block, ch, 0, numSamples);
+        }
+
+        return whole;
+    }
+};
+
+static MidiToAudioTests midiToAudioTests;
@@ -0,0 +1,133 @@
+#include <JuceHeader.h>
+
+class PatternGeneratorTests : public juce::UnitTest
+{
+public:
+    PatternGeneratorTests() : juce::UnitTest("PatternGenerator", "Loop tools") {}
+
+    void runTest() override
+    {
+        beginTest("Notes are in order, on the grid and in range");
+        {
+            RhythmGenerator::GeneratorSettings settings;
+            settings.sustain = 0.5f;
+
+            // 16ths, triplets and 7/4, across a spread of seeds
+            for (auto [beatsPerBar, stepsPerBeat] : {std::pair{4, 4}, std::pair{4, 3}, std::pair{7, 2}})
+            {
+                settings.beatsPerBar = beatsPerBar;
+                settings.stepsPerBeat = stepsPerBeat;
+
+                for (int i = 0; i < 50; ++i)
+                {
+                    const auto pattern = RhythmGenerator::generatePattern(settings, getRandom().nextInt64());
+                    expectEquals(pattern.getNumSteps(), settings.numBars * beatsPerBar * stepsPerBeat);
+                    expectWellFormed(pattern, settings.midiNote);
+                }
+            }
+        }
+
+        beginTest("The same seed gives the same pattern");
+        {
+            RhythmGenerator::GeneratorSettings settings;
+            settings.sustain = 0.3f;
+
+            for (juce::int64 seed : {0LL, 1LL, 42LL, -7LL, 0x7fffffffffffLL})
+            {
+                const auto first = RhythmGenerator::generatePattern(settings, seed);
+
+                // Also when generated into a Pattern that already holds other notes
+                auto second = RhythmGenerator::generatePattern(settings, seed + 1);
+                RhythmGenerator::generatePattern(settings, seed, second);
+
+                expect(sameNotes(first, second), "seed " + juce::String(seed));
+            }
+        }
+
+        beginTest("Different seeds give different patterns");
+        {
+            RhythmGenerator::GeneratorSettings settings;
+
+            // Any two seeds may collide, but not most of a hundred
+            const auto reference = RhythmGenerator::generatePattern(settings, 1);
+            int numDifferent = 0;
+            for (int seed = 2; seed <= 101; ++seed)
+                if (!sameNotes(reference, RhythmGenerator::generatePattern(settings, seed)))
+                    ++numDifferent;
+
+            expectGreaterThan(numDifferent, 95);
+        }
+
+        beginTest("Density and fills shape the pattern");
+        {
+            RhythmGenerator::GeneratorSettings settings;
+            settings.density = 0.0f;
+            settings.fillEveryBars = 0;
+            expect(RhythmGenerator::generatePattern(settings, 1).notes.empty());
+
+            // Full density with no syncopation hits every strong step
+            settings.density = 1.0f;
+            settings.syncopation = 0.0f;
+            settings.variation = 0.0f;
+            const auto busy = RhythmGenerator::generatePattern(settings, 1);
+            for (int beat = 0; beat < busy.getNumBeats(); ++beat)
+                expect(hasNoteAt(busy, beat * settings.stepsPerBeat), "beat " + juce::String(beat));
+
+            // A fill bar only adds hits to an otherwise empty pattern in its last beat
+            settings.density = 0.0f;
+            settings.fillEveryBars = 2;
+            settings.fillAmount = 1.0f;
+            const auto fills = RhythmGenerator::generatePattern(settings, 1);
+            const int stepsPerBar = settings.beatsPerBar * settings.stepsPerBeat;
+            expect(!fills.notes.empty());
+            for (const auto &note : fills.notes)
+            {
+                const int bar = note.startStep / stepsPerBar;
+                expect(bar % 2 == 1 && note.startStep % stepsPerBar >= stepsPerBar - settings.stepsPerBeat);
+            }
+        }
+
+        beginTest("Swing is copied to the pattern");
+        {
+            RhythmGenerator::GeneratorSettings settings;
+            settings.swing = 0.6f;
+            expectEquals(RhythmGenerator::generatePattern(settings, 3).swing, 0.6f);
+        }
+    }
+
+private:
+    void expectWellFormed(const RhythmGenerator::Pattern &pattern, int midiNote)
+    {
+        int nextFreeStep = 0;
+        for (const auto &note : pattern.notes)
+        {
+            // Notes never overlap, so each starts where or after the last one ended
+            expect(note.startStep >= nextFreeStep);
+            expect(note.lengthSteps >= 1);
+            expect(note.startStep + note.lengthSteps <= pattern.getNumSteps());
+            expectEquals(note.midiNote, midiNote);
+            expect(note.velocity >= 0.1f && note.velocity <= 1.0f);
+            nextFreeStep = note.startStep + note.lengthSteps;
+        }
+    }
+
+    static bool sameNotes(const RhythmGenerator::Pattern &a, const RhythmGenerator::Pattern &b)
+    {
+        return std::equal(a.notes.begin(), a.notes.end(), b.notes.begin(), b.notes.end(),
+                          [](const RhythmGenerator::NoteEvent &x, const RhythmGenerator::NoteEvent &y)
+                          {
+                              return x.startStep == y.startStep && x.lengthSteps == y.lengthSteps
+                                     && x.midiNote == y.midiNote && x.velocity == y.velocity;
+                          });
+    }
+
+    static bool hasNoteAt(const RhythmGenerator::Pattern &pattern, int step)
+    {
+        for (const auto &note : pattern.notes)
+            if (note.startStep == step)
+                return true;
+        return false;
+    }
+};
+
+static PatternGeneratorTests patternGeneratorTests;
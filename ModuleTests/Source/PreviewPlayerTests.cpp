@@ -0,0 +1,82 @@
+#include <JuceHeader.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "../../JBProducer/Source/Service/PreviewPlayer.h"
+
+class PreviewPlayerTests : public juce::UnitTest
+{
+public:
+    PreviewPlayerTests() : juce::UnitTest("PreviewPlayer", "Loop tools") {}
+
+    void runTest() override
+    {
+        beginTest("The last play or stop is always picked up, however fast they come");
+        {
+            std::vector<std::weak_ptr<const juce::AudioBuffer<float>>> loops;
+
+            {
+                PreviewPlayer player;
+                std::atomic<bool> running{true};
+
+                // The audio thread, processing small blocks as fast as it can
+                std::thread audioThread([&]
+                                        {
+                                            juce::AudioBuffer<float> block(2, 64);
+                                            while (running.load())
+                                            {
+                                                block.clear();
+                                                player.process(block, nullptr);
+                                            }
+                                        });
+
+                for (int i = 0; i < 20000; ++i)
+                {
+                    if (i % 2 == 0)
+                    {
+                        auto audio = createLoop();
+                        loops.push_back(audio);
+                        player.play(std::move(audio), 4.0);
+                    }
+                    else
+                    {
+                        player.stop();
+                    }
+                }
+
+                // A play that lands last must sound, then a stop must silence it
+                player.play(createLoop(), 4.0);
+                running.store(false);
+                audioThread.join();
+
+                juce::AudioBuffer<float> block(2, 64);
+                block.clear();
+                player.process(block, nullptr);
+                expectGreaterThan(block.getMagnitude(0, block.getNumSamples()), 0.0f, "the last play was lost");
+
+                player.stop();
+                block.clear();
+                player.process(block, nullptr);
+                expectEquals(block.getMagnitude(0, block.getNumSamples()), 0.0f, "the stop was lost");
+            }
+
+            // Every loop handed over was released once the player was gone
+            int leaked = 0;
+            for (auto &loop : loops)
+                if (!loop.expired())
+                    ++leaked;
+            expectEquals(leaked, 0);
+        }
+    }
+
+private:
+    static PreviewPlayer::Audio createLoop()
+    {
+        auto audio = std::make_shared<juce::AudioBuffer<float>>(2, 1024);
+        for (int ch = 0; ch < 2; ++ch)
+            juce::FloatVectorOperations::fill(audio->getWritePointer(ch), 0.5f, audio->getNumSamples());
+        return audio;
+    }
+};
+
+static PreviewPlayerTests previewPlayerTests;
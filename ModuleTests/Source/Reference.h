@@ -0,0 +1,170 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include <cmath>
+#include <map>
+
+/**
+ * The straightforward implementations that the module code replaced, kept so
+ * the tests can check the faster versions against them and the benchmarks can
+ * time them side by side.
+ */
+namespace Reference
+{
+    /** One sample of AudioLoopGenerator's naive waveforms (0=Sine, 1=Square, 2=Saw, 3=Triangle) at phase 0..1. */
+    inline float naiveWaveform(int waveformType, double phase)
+    {
+        switch (waveformType)
+        {
+        case 1: // Square
+            return phase < 0.5 ? 1.0f : -1.0f;
+
+        case 2: // Saw
+            return static_cast<float>(2.0 * phase - 1.0);
+
+        case 3: // Triangle
+            return phase < 0.5
+                       ? static_cast<float>(4.0 * phase - 1.0)
+                       : static_cast<float>(3.0 - 4.0 * phase);
+
+        default: // Sine
+            return static_cast<float>(std::sin(2.0 * juce::MathConstants<double>::pi * phase));
+        }
+    }
+
+    /** AudioLoopGenerator::generateAudioLoop as it was: fmod, sin and exp on every sample of every channel. */
+    inline juce::AudioBuffer<float> generateAudioLoop(float frequency,
+                                                      int lengthInSamples,
+                                                      double sampleRate,
+                                                      float bpm,
+                                                      int waveformType,
+                                                      int numChannels)
+    {
+        juce::AudioBuffer<float> buffer(numChannels, lengthInSamples);
+        buffer.clear();
+
+        for (int channel = 0; channel < numChannels; ++channel)
+        {
+            float *channelData = buffer.getWritePointer(channel);
+
+            for (int sample = 0; sample < lengthInSamples; ++sample)
+            {
+                const double time = sample / sampleRate;
+                const float value = naiveWaveform(waveformType, std::fmod(time * frequency, 1.0));
+
+                const double beatPosition = std::fmod(time * bpm / 60.0, 1.0);
+                const auto envelope = static_cast<float>(0.7f + 0.3f * std::exp(-beatPosition * 4.0));
+
+                channelData[sample] = value * 0.5f * envelope;
+            }
+        }
+
+        return buffer;
+    }
+
+    /** MidiNoteHandler::midiNoteToFrequency as it was: a float pow per call. */
+    inline float midiNoteToFrequency(int midiNote)
+    {
+        if (midiNote < 0 || midiNote > 127)
+            return 0.0f;
+        return 440.0f * std::pow(2.0f, (static_cast<float>(midiNote) - 69.0f) / 12.0f);
+    }
+
+    /** MidiNoteHandler::frequencyToMidiNote as it was: rounds 12 * log2(frequency / 440) + 69 and clamps. */
+    inline int frequencyToMidiNote(float frequency)
+    {
+        if (frequency <= 0.0f)
+            return -1;
+
+        const int midiNote = static_cast<int>(std::round(12.0 * std::log2(static_cast<double>(frequency) / 440.0) + 69.0));
+        return juce::jlimit(0, 127, midiNote);
+    }
+
+    /** MidiNoteHandler::frequencyToNote as it was: looks the note up in a map built on the first call. */
+    inline MidiNoteHandler::NoteName frequencyToNote(float frequency)
+    {
+        using namespace MidiNoteHandler;
+
+        const int targetMidiNote = frequencyToMidiNote(frequency);
+        if (targetMidiNote < 0)
+            return A4;
+
+        // Every name in enum order, so the first name for a MIDI number wins
+        static const std::map<int, NoteName> midiToNoteMap = []
+        {
+            std::map<int, NoteName> map;
+            for (int i = 0; i < numNoteNames; ++i)
+            {
+                const int midiNote = computeMidiNote(static_cast<NoteName>(i));
+                if (midiNote >= 0 && map.find(midiNote) == map.end())
+                    map[midiNote] = static_cast<NoteName>(i);
+            }
+            return map;
+        }();
+
+        auto it = midiToNoteMap.find(targetMidiNote);
+        return it != midiToNoteMap.end() ? it->second : A4;
+    }
+
+    /**
+     * MidiToAudio::convert as it was before hits were mixed in place: every note
+     * repitches the sample into a buffer of its own at a fixed 0.7 (whatever its
+     * velocity), fades it out and adds it to the output sample by sample.
+     */
+    inline juce::AudioBuffer<float> convert(const RhythmGenerator::Pattern &pattern,
+                                            const void *data,
+                                            size_t dataSize,
+                                            float bpm,
+                                            int numChannels,
+                                            double sampleRate)
+    {
+        const int samplesPerBeat = static_cast<int>(sampleRate * 60.0 / bpm);
+        const int totalSamples = samplesPerBeat * pattern.getNumBeats();
+
+        juce::AudioBuffer<float> output(numChannels, totalSamples);
+        output.clear();
+
+        const auto sample = SampleLoopGenerator::getDecodedSample(data, dataSize);
+        const double samplesPerStep = static_cast<double>(samplesPerBeat) / pattern.stepsPerBeat;
+        const int maxDuration = samplesPerBeat / pattern.stepsPerBeat;
+
+        for (const auto &event : pattern.notes)
+        {
+            const double start = pattern.getStepPosition(event.startStep);
+            const double end = pattern.getStepPosition(event.startStep + event.lengthSteps);
+            const int startSample = static_cast<int>(start * samplesPerStep);
+            const int lengthInSamples = juce::jmin(static_cast<int>((end - start) * samplesPerStep), maxDuration);
+            if (lengthInSamples <= 0)
+                continue;
+
+            auto noteBuf = SampleLoopGenerator::generateSampleLoop(*sample,
+                                                                   MidiNoteHandler::midiNoteToFrequency(event.midiNote),
+                                                                   lengthInSamples,
+                                                                   sampleRate,
+                                                                   bpm,
+                                                                   numChannels,
+                                                                   130.81278f,
+                                                                   0.7f);
+
+            constexpr double fadeDurationSec = 0.005; // 5ms fade
+            const int fadeSamples = juce::jmin(lengthInSamples, static_cast<int>(sampleRate * fadeDurationSec));
+            for (int ch = 0; ch < numChannels; ++ch)
+            {
+                float *buf = noteBuf.getWritePointer(ch);
+                for (int i = 0; i < fadeSamples; ++i)
+                    buf[lengthInSamples - 1 - i] *= static_cast<float>(i) / fadeSamples;
+            }
+
+            for (int ch = 0; ch < numChannels; ++ch)
+            {
+                float *dest = output.getWritePointer(ch);
+                const float *src = noteBuf.getReadPointer(ch);
+                for (int n = 0; n < lengthInSamples; ++n)
+                    if (startSample + n < totalSamples)
+                        dest[startSample + n] += src[n];
+            }
+        }
+
+        return output;
+    }
+}
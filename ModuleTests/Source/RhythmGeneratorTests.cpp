@@ -0,0 +1,64 @@
+#include <JuceHeader.h>
+
+class RhythmGeneratorTests : public juce::UnitTest
+{
+public:
+    RhythmGeneratorTests() : juce::UnitTest("RhythmGenerator", "Loop tools") {}
+
+    void runTest() override
+    {
+        RhythmGenerator::Pattern pattern;
+        pattern.notes = {{0, 2, 36, 1.0f}, {4, 1, 38, 0.7f}, {10, 1, 42, 0.5f}};
+
+        beginTest("Kit MIDI files have the tempo and a channel per layer");
+        {
+            const auto file = read(RhythmGenerator::createMIDISequence(std::vector<RhythmGenerator::Pattern>(3, pattern), 90.0f));
+            expectEquals(file.getNumTracks(), 3);
+            expectTempo(file, 90.0);
+
+            for (int t = 0; t < file.getNumTracks(); ++t)
+            {
+                int numNotes = 0;
+                for (auto *event : *file.getTrack(t))
+                {
+                    if (event->message.isNoteOn())
+                    {
+                        expectEquals(event->message.getChannel(), t + 1);
+                        ++numNotes;
+                    }
+                }
+                expectEquals(numNotes, (int)pattern.notes.size());
+            }
+        }
+
+        beginTest("Single loops are one track with the tempo");
+        {
+            const auto file = read(RhythmGenerator::createMIDISequence(pattern, 140.0f));
+            expectEquals(file.getNumTracks(), 1);
+            expectTempo(file, 140.0);
+        }
+    }
+
+private:
+    static juce::MidiFile read(const juce::MemoryBlock &data)
+    {
+        juce::MidiFile file;
+        juce::MemoryInputStream stream(data, false);
+        file.readFrom(stream);
+        return file;
+    }
+
+    void expectTempo(const juce::MidiFile &file, double bpm)
+    {
+        // The tempo sits at the very start of the first track
+        const auto *first = file.getTrack(0)->getEventPointer(0);
+        expect(first != nullptr && first->message.isTempoMetaEvent());
+
+        juce::MidiMessageSequence tempoEvents;
+        file.findAllTempoEvents(tempoEvents);
+        expectEquals(tempoEvents.getNumEvents(), 1);
+        expectWithinAbsoluteError(tempoEvents.getEventPointer(0)->message.getTempoSecondsPerQuarterNote(), 60.0 / bpm, 1.0e-6);
+    }
+};
+
+static RhythmGeneratorTests rhythmGeneratorTests;
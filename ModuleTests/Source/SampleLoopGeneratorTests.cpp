@@ -0,0 +1,71 @@
+#include "TestSamples.h"
+
+class SampleLoopGeneratorTests : public juce::UnitTest
+{
+public:
+    SampleLoopGeneratorTests() : juce::UnitTest("SampleLoopGenerator", "Loop tools") {}
+
+    void runTest() override
+    {
+        const auto &tone = TestSamples::getToneWav();
+        const auto sample = SampleLoopGenerator::getDecodedSample(tone.getData(), tone.getSize());
+
+        beginTest("getDecodedSample decodes once");
+        {
+            expect(sample == SampleLoopGenerator::getDecodedSample(tone.getData(), tone.getSize()));
+            expectEquals(sample->getNumSamples(), (int)(TestSamples::sampleRate / 2));
+        }
+
+        beginTest("getRepitchedSample shares one copy per pitch");
+        {
+            const float c3 = TestSamples::toneFrequency;
+            const auto original = SampleLoopGenerator::getRepitchedSample(sample, c3);
+            expect(original == SampleLoopGenerator::getRepitchedSample(sample, c3));
+            expect(original != SampleLoopGenerator::getRepitchedSample(sample, 2.0f * c3));
+
+            // Unity pitch stops one sample short: interpolation needs the next one
+            expectEquals(original->getNumSamples(), sample->getNumSamples() - 1);
+            expectEquals(original->getSample(0, 100), sample->getSample(0, 100));
+
+            // An octave up reads twice as fast, so it runs out in half the time
+            const auto octaveUp = SampleLoopGenerator::getRepitchedSample(sample, 2.0f * c3);
+            expectEquals(octaveUp->getNumSamples(), sample->getNumSamples() / 2);
+            expectWithinAbsoluteError(octaveUp->getSample(0, 100), sample->getSample(0, 200), 1.0e-6f);
+        }
+
+        beginTest("Concurrent callers get the same copy");
+        {
+            constexpr int numThreads = 4;
+            const float pitch = TestSamples::toneFrequency * 1.5f;
+            SampleLoopGenerator::RepitchedSample results[numThreads];
+
+            juce::ThreadPool pool(numThreads);
+            for (int i = 0; i < numThreads; ++i)
+                pool.addJob([&, i]
+                            { results[i] = SampleLoopGenerator::getRepitchedSample(sample, pitch); });
+
+            while (pool.getNumJobs() > 0)
+                juce::Thread::sleep(1);
+
+            for (auto &result : results)
+                expect(result != nullptr && result == results[0]);
+        }
+
+        beginTest("addRepitchedHit mixes only the part inside the buffer");
+        {
+            const auto repitched = SampleLoopGenerator::getRepitchedSample(sample, TestSamples::toneFrequency);
+            juce::AudioBuffer<float> whole(1, 2000), part(1, 500);
+            whole.clear();
+            part.clear();
+
+            SampleLoopGenerator::addRepitchedHit(whole, 100, 1500, *repitched, 200, 0.5f);
+            SampleLoopGenerator::addRepitchedHit(part, 100 - 1200, 1500, *repitched, 200, 0.5f);
+
+            expectEquals(whole.getMagnitude(0, 1600, 400), 0.0f);
+            for (int i = 0; i < 500; ++i)
+                expectWithinAbsoluteError(part.getSample(0, i), whole.getSample(0, 1200 + i), 1.0e-6f);
+        }
+    }
+};
+
+static SampleLoopGeneratorTests sampleLoopGeneratorTests;
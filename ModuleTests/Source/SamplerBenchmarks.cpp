@@ -0,0 +1,147 @@
+#include "Benchmark.h"
+#include "TestSamples.h"
+
+class SamplerBenchmarks : public juce::UnitTest
+{
+public:
+    SamplerBenchmarks() : juce::UnitTest("Sampler", Benchmark::category) {}
+
+    void runTest() override
+    {
+        constexpr double sampleRate = 44100.0;
+        constexpr int blockSize = 512;
+        constexpr double renderSeconds = 0.25; // the tone lasts at least this long at every pitch played
+
+        beginTest("PolySynthesiser");
+        {
+            for (int numVoices : {8, 64, 256})
+            {
+                PolySynthesiser synth(numVoices);
+                synth.addSound(createSound());
+                synth.setCurrentPlaybackSampleRate(sampleRate);
+
+                // Note-ons over 16 channels: once the pool is full every note retriggers or steals a voice
+                constexpr int notesPerRun = 1024;
+                int note = 0;
+                auto noteOns = [&]
+                {
+                    for (int i = 0; i < notesPerRun; ++i, ++note)
+                        synth.noteOn(1 + (note / numPlayedNotes) % 16, firstPlayedNote + note % numPlayedNotes, 0.8f);
+                };
+
+                const auto noteOnSeconds = Benchmark::secondsPerRun(noteOns) / notesPerRun;
+                synth.allNotesOff(0, false);
+
+                // Every voice sounding, on its own note, for the whole render
+                juce::AudioBuffer<float> block(2, blockSize);
+                juce::MidiBuffer noMidi;
+                auto render = [&]
+                {
+                    for (int i = 0; i < numVoices; ++i)
+                        synth.noteOn(1 + i / numPlayedNotes, firstPlayedNote + i % numPlayedNotes, 0.8f);
+
+                    for (int start = 0; start < (int)(renderSeconds * sampleRate); start += blockSize)
+                    {
+                        block.clear();
+                        synth.renderNextBlock(block, noMidi, 0, blockSize);
+                    }
+
+                    synth.allNotesOff(0, false);
+                    Benchmark::sink = block.getSample(0, 0);
+                };
+
+                const auto renderSecondsPerSecond = Benchmark::secondsPerRun(render) / renderSeconds;
+                logMessage(juce::String(numVoices) + " voices: " + juce::String(noteOnSeconds * 1.0e9, 0) + " ns per note-on, "
+                           + juce::String(renderSecondsPerSecond * 100.0, 2) + "% of realtime to render, "
+                           + juce::String(renderSecondsPerSecond * 1.0e6 / numVoices, 2) + " us per voice-second");
+            }
+        }
+
+        beginTest("SampleVoice against juce::SamplerVoice");
+        {
+            // The same plain juce::Synthesiser for both, so only the voices differ
+            constexpr int numVoices = 64;
+
+            auto timeRender = [&](juce::Synthesiser &synth)
+            {
+                synth.setCurrentPlaybackSampleRate(sampleRate);
+
+                juce::AudioBuffer<float> block(2, blockSize);
+                juce::MidiBuffer noMidi;
+                auto render = [&]
+                {
+                    for (int i = 0; i < numVoices; ++i)
+                        synth.noteOn(1 + i / numPlayedNotes, firstPlayedNote + i % numPlayedNotes, 0.8f);
+
+                    for (int start = 0; start < (int)(renderSeconds * sampleRate); start += blockSize)
+                    {
+                        block.clear();
+                        synth.renderNextBlock(block, noMidi, 0, blockSize);
+                    }
+
+                    synth.allNotesOff(0, false);
+                    Benchmark::sink = block.getSample(0, 0);
+                };
+
+                return Benchmark::secondsPerRun(render) / renderSeconds;
+            };
+
+            juce::Synthesiser juceSynth;
+            for (int i = 0; i < numVoices; ++i)
+                juceSynth.addVoice(new juce::SamplerVoice());
+            juceSynth.addSound(createJuceSound());
+            const auto juceSeconds = timeRender(juceSynth);
+            logMessage("juce::SamplerVoice: " + juce::String(juceSeconds * 100.0, 2) + "% of realtime for " + juce::String(numVoices) + " voices");
+
+            for (auto interpolation : {SampleVoice::Interpolation::linear, SampleVoice::Interpolation::hermite})
+            {
+                juce::Synthesiser synth;
+                for (int i = 0; i < numVoices; ++i)
+                {
+                    auto *voice = new SampleVoice();
+                    voice->setInterpolation(interpolation);
+                    synth.addVoice(voice);
+                }
+                synth.addSound(createSound());
+
+                const auto seconds = timeRender(synth);
+                logMessage(juce::String("SampleVoice, ") + (interpolation == SampleVoice::Interpolation::linear ? "linear" : "hermite")
+                           + ": " + juce::String(seconds * 100.0, 2) + "% of realtime, " + juce::String(juceSeconds / seconds, 2)
+                           + "x juce::SamplerVoice");
+            }
+        }
+    }
+
+private:
+    // An octave either side of the tone's pitch
+    static constexpr int rootNote = 48;
+    static constexpr int firstPlayedNote = 36;
+    static constexpr int numPlayedNotes = 25;
+
+    static std::unique_ptr<juce::AudioFormatReader> createToneReader()
+    {
+        return std::unique_ptr<juce::AudioFormatReader>(
+            juce::WavAudioFormat().createReaderFor(new juce::MemoryInputStream(TestSamples::getToneWav(), false), true));
+    }
+
+    static juce::BigInteger allNotes()
+    {
+        juce::BigInteger notes;
+        notes.setRange(0, 128, true);
+        return notes;
+    }
+
+    /** The test tone as a SampleSound on every note, played unpitched at C3. */
+    static SampleSound *createSound()
+    {
+        return new SampleSound("Tone", *createToneReader(), allNotes(), rootNote, 0.0, 0.1, 10.0);
+    }
+
+    /** The same, as the juce::SamplerSound it replaces. */
+    static juce::SamplerSound *createJuceSound()
+    {
+        return new juce::SamplerSound("Tone", *createToneReader(), allNotes(), rootNote, 0.0, 0.1, 10.0);
+    }
+};
+
+static SamplerBenchmarks samplerBenchmarks;
@@ -0,0 +1,127 @@
+#include <JuceHeader.h>
+
+namespace
+{
+    using RhythmGenerator::StepPattern;
+
+    // Built and checked entirely at compile time
+    constexpr auto kick = StepPattern<1, 8>{}.trigger(0, 48).trigger(4, 48, 100).hold(5).hold(6);
+    static_assert(kick.getNumNotes() == 2);
+    static_assert(kick.isTrigger(4) && kick.isContinuation(5) && !kick.isTrigger(5));
+    static_assert(kick.getNoteLength(0) == 1 && kick.getNoteLength(4) == 3);
+    static_assert(kick.velocities[4] == 100 && kick.pitches[4] == 48);
+
+    // A note held across the boundary between two 64-step words
+    constexpr auto longNote = []
+    {
+        StepPattern<2, 64> pattern;
+        pattern.trigger(60, 36);
+        for (int step = 61; step < 70; ++step)
+            pattern.hold(step);
+        return pattern;
+    }();
+    static_assert(longNote.numWords == 2);
+    static_assert(longNote.getNoteLength(60) == 10);
+}
+
+class StepPatternTests : public juce::UnitTest
+{
+public:
+    StepPatternTests() : juce::UnitTest("StepPattern", "Loop tools") {}
+
+    void runTest() override
+    {
+        beginTest("forEachNote visits the notes in order");
+        {
+            std::vector<RhythmGenerator::NoteEvent> events;
+            RhythmGenerator::collectNoteEvents(longNote, events);
+            expectEquals((int)events.size(), 1);
+            expectEquals(events[0].startStep, 60);
+            expectEquals(events[0].lengthSteps, 10);
+
+            auto pattern = RhythmGenerator::StepPattern<4, 16>{}.trigger(63, 40).trigger(64, 41).hold(65).trigger(0, 42);
+            RhythmGenerator::collectNoteEvents(pattern, events);
+            expectEquals((int)events.size(), 3);
+            expectEquals(events[0].startStep, 0);
+            expectEquals(events[1].startStep, 63);
+            expectEquals(events[2].startStep, 64);
+            expectEquals(events[2].lengthSteps, 2);
+        }
+
+        beginTest("clear turns a step into a rest");
+        {
+            auto pattern = kick;
+            pattern.clear(4);
+            expectEquals(pattern.getNumNotes(), 1);
+            expect(!pattern.isTrigger(4));
+        }
+
+        beginTest("Packed Loop8s hold the same notes as the loop");
+        {
+            for (int i = 0; i < 100; ++i)
+            {
+                RhythmGenerator::Loop8 loop{};
+                fillBars(loop.bar_1.notes, loop.bar_2.notes, loop.bar_3.notes, loop.bar_4.notes);
+                expectSameNotes(RhythmGenerator::toStepPattern(loop), loop);
+            }
+        }
+
+        beginTest("Packed Loop16s hold the same notes as the loop");
+        {
+            for (int i = 0; i < 100; ++i)
+            {
+                RhythmGenerator::Loop16 loop{};
+                fillBars(loop.bar_1.notes, loop.bar_2.notes, loop.bar_3.notes, loop.bar_4.notes);
+                expectSameNotes(RhythmGenerator::toStepPattern(loop), loop);
+            }
+        }
+
+        beginTest("toPattern keeps the grid");
+        {
+            const auto pattern = RhythmGenerator::toPattern(RhythmGenerator::StepPattern<3, 12, 4>{}.trigger(5, 50));
+            expectEquals(pattern.numBars, 3);
+            expectEquals(pattern.beatsPerBar, 4);
+            expectEquals(pattern.stepsPerBeat, 3);
+            expectEquals((int)pattern.notes.size(), 1);
+        }
+    }
+
+private:
+    // Random notes, rests and continuations, including continuations after rests
+    template <size_t N>
+    void fillBars(RhythmGenerator::MusicNote (&b1)[N], RhythmGenerator::MusicNote (&b2)[N],
+                  RhythmGenerator::MusicNote (&b3)[N], RhythmGenerator::MusicNote (&b4)[N])
+    {
+        auto &random = getRandom();
+        for (auto *bar : {b1, b2, b3, b4})
+        {
+            for (size_t i = 0; i < N; ++i)
+            {
+                bar[i].noteType = (RhythmGenerator::NoteType)random.nextInt(3);
+                bar[i].velocity = random.nextFloat() * 1.2f - 0.1f;
+                bar[i].frequency = (MidiNoteHandler::NoteName)random.nextInt(MidiNoteHandler::numNoteNames);
+            }
+        }
+    }
+
+    template <typename Packed, typename Loop>
+    void expectSameNotes(const Packed &packed, const Loop &loop)
+    {
+        std::vector<RhythmGenerator::NoteEvent> expected, actual;
+        RhythmGenerator::collectNoteEvents(loop, expected);
+        RhythmGenerator::collectNoteEvents(packed, actual);
+
+        expectEquals((int)actual.size(), (int)expected.size());
+        for (size_t i = 0; i < juce::jmin(actual.size(), expected.size()); ++i)
+        {
+            expectEquals(actual[i].startStep, expected[i].startStep);
+            expectEquals(actual[i].lengthSteps, expected[i].lengthSteps);
+            expectEquals(actual[i].midiNote, expected[i].midiNote);
+
+            // The packed form keeps velocities as MIDI bytes
+            expectWithinAbsoluteError(actual[i].velocity, expected[i].velocity, 0.5f / 127.0f);
+        }
+    }
+};
+
+static StepPatternTests stepPatternTests;
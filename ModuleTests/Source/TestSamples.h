@@ -0,0 +1,65 @@
+#pragma once
+
+#include <JuceHeader.h>
+#include <cmath>
+#include <limits>
+
+namespace TestSamples
+{
+    constexpr double sampleRate = 44100.0;
+    constexpr float toneFrequency = 130.81278f; // C3, the pitch the loop services assume
+
+    /**
+     * A decaying C3 tone, half a second long, encoded as a 16-bit mono WAV. It
+     * stands in for the BinaryData samples and, like them, lives for the whole
+     * run: the loop services cache decoded samples by their data pointer.
+     */
+    inline const juce::MemoryBlock &getToneWav()
+    {
+        static const juce::MemoryBlock wav = []
+        {
+            juce::AudioBuffer<float> tone(1, (int)(sampleRate / 2));
+            for (int i = 0; i < tone.getNumSamples(); ++i)
+            {
+                const double t = i / sampleRate;
+                tone.setSample(0, i, (float)(0.8 * std::exp(-6.0 * t) * std::sin(juce::MathConstants<double>::twoPi * toneFrequency * t)));
+            }
+            return WavWriter::createWavFile(tone, sampleRate);
+        }();
+        return wav;
+    }
+
+    /** Decodes a WAV file held in memory, or returns an empty buffer if it can't be read. */
+    inline juce::AudioBuffer<float> decodeWav(const juce::MemoryBlock &wav, double *sampleRate = nullptr, int *bitsPerSample = nullptr)
+    {
+        std::unique_ptr<juce::AudioFormatReader> reader(
+            juce::WavAudioFormat().createReaderFor(new juce::MemoryInputStream(wav, false), true));
+
+        juce::AudioBuffer<float> audio;
+        if (reader == nullptr)
+            return audio;
+
+        if (sampleRate != nullptr)
+            *sampleRate = reader->sampleRate;
+        if (bitsPerSample != nullptr)
+            *bitsPerSample = (int)reader->bitsPerSample;
+
+        audio.setSize((int)reader->numChannels, (int)reader->lengthInSamples);
+        reader->read(&audio, 0, audio.getNumSamples(), 0, true, true);
+        return audio;
+    }
+
+    /** Largest difference between two buffers of the same size, or infinity if their sizes differ. */
+    inline float maxDifference(const juce::AudioBuffer<float> &a, const juce::AudioBuffer<float> &b)
+    {
+        if (a.getNumChannels() != b.getNumChannels() || a.getNumSamples() != b.getNumSamples())
+            return std::numeric_limits<float>::infinity();
+
+        float difference = 0.0f;
+        for (int ch = 0; ch < a.getNumChannels(); ++ch)
+            for (int i = 0; i < a.getNumSamples(); ++i)
+                difference = juce::jmax(difference, std::abs(a.getSample(ch, i) - b.getSample(ch, i)));
+
+        return difference;
+    }
+}
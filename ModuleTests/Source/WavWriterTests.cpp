@@ -0,0 +1,87 @@
+#include "TestSamples.h"
+
+class WavWriterTests : public juce::UnitTest
+{
+public:
+    WavWriterTests() : juce::UnitTest("WavWriter", "Loop tools") {}
+
+    void runTest() override
+    {
+        const auto audio = makeNoise(2, 10000);
+
+        beginTest("createWavFile round-trips every bit depth");
+        {
+            // Integer formats round, and scale by 2^(n-1) - 1 on the way in but 2^(n-1)
+            // on the way out, so allow two steps; float is exact
+            const std::pair<int, float> formats[] = {{16, 2.0f / 32768.0f}, {24, 2.0f / 8388608.0f}, {32, 0.0f}};
+            for (auto [bits, tolerance] : formats)
+            {
+                double sampleRate = 0.0;
+                int bitsPerSample = 0;
+                auto decoded = TestSamples::decodeWav(WavWriter::createWavFile(audio, 48000.0, bits), &sampleRate, &bitsPerSample);
+
+                expectEquals(bitsPerSample, bits);
+                expectEquals(sampleRate, 48000.0);
+                expectWithinAbsoluteError(TestSamples::maxDifference(decoded, audio), 0.0f, tolerance,
+                                          juce::String(bits) + "-bit");
+            }
+        }
+
+        beginTest("writeWavFile writes the same file as createWavFile");
+        {
+            // 10000 samples: two whole stream blocks and a partial one
+            for (int bits : {16, 24, 32})
+            {
+                juce::MemoryBlock streamed;
+                const bool ok = WavWriter::writeWavFile(
+                    std::make_unique<juce::MemoryOutputStream>(streamed, false),
+                    audio.getNumSamples(), audio.getNumChannels(), 44100.0, bits,
+                    [&](juce::AudioBuffer<float> &block, int blockStart)
+                    {
+                        for (int ch = 0; ch < block.getNumChannels(); ++ch)
+                            block.copyFrom(ch, 0, audio, ch, blockStart, block.getNumSamples());
+                    });
+
+                expect(ok);
+                expect(streamed == WavWriter::createWavFile(audio, 44100.0, bits), juce::String(bits) + "-bit");
+            }
+        }
+
+        beginTest("writeWavFile hands each block over cleared");
+        {
+            bool allCleared = true;
+            juce::MemoryBlock streamed;
+            WavWriter::writeWavFile(std::make_unique<juce::MemoryOutputStream>(streamed, false),
+                                    3 * WavWriter::streamBlockSize, 1, 44100.0, 16,
+                                    [&](juce::AudioBuffer<float> &block, int)
+                                    {
+                                        allCleared = allCleared && block.getMagnitude(0, 0, block.getNumSamples()) == 0.0f;
+                                        block.setSample(0, 0, 1.0f);
+                                    });
+            expect(allCleared);
+        }
+
+        beginTest("writeWavFile rejects a missing stream or no channels");
+        {
+            auto renderNothing = [](juce::AudioBuffer<float> &, int) {};
+            juce::MemoryBlock streamed;
+
+            expect(!WavWriter::writeWavFile(nullptr, 100, 2, 44100.0, 16, renderNothing));
+            expect(!WavWriter::writeWavFile(std::make_unique<juce::MemoryOutputStream>(streamed, false),
+                                            100, 0, 44100.0, 16, renderNothing));
+        }
+    }
+
+private:
+    juce::AudioBuffer<float> makeNoise(int numChannels, int numSamples)
+    {
+        auto &random = getRandom();
+        juce::AudioBuffer<float> noise(numChannels, numSamples);
+        for (int ch = 0; ch < numChannels; ++ch)
+            for (int i = 0; i < numSamples; ++i)
+                noise.setSample(ch, i, 0.9f * (2.0f * random.nextFloat() - 1.0f));
+        return noise;
+    }
+};
+
+static WavWriterTests wavWriterTests;
@@ -1,7 +1,6 @@
 #pragma once
 
 #include <JuceHeader.h>
-#include "../DSP/Fifo.h"
 #include "../DSP/BasicAudioProcessor.h"
 
 namespace GUI
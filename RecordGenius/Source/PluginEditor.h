@@ -10,7 +10,6 @@
 
 #include <JuceHeader.h>
 #include "PluginProcessor.h"
-#include "Service/DraggableLoopComponent.h"
 #include "GUI/CustomLookAndFeel.h"
 #include "GUI/FFTComponents.h"
 #include "GUI/ResponseCurveComponent.h"
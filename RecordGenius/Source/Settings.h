@@ -1,7 +1,6 @@
 #pragma once
 
 #include <JuceHeader.h>
-#include "DSP/DSPUtilities.h"
 
 using namespace DSP; // for the DSP utilities
 using CutFilter = juce::dsp::ProcessorChain<Filter, Filter, Filter, Filter>;
@@ -20,25 +20,4 @@ namespace DSP
 
         return settings; // return the settings struct
     }
-
-    Coefficients makePeakFilter(const ChainSettings &chainSettings, double sampleRate)
-    {
-        auto nyquist = static_cast<float>(sampleRate / 2.0);
-        float clampedPeakFreq = std::min(chainSettings.peakFreq, nyquist * 0.95f);
-
-        auto gain = juce::Decibels::decibelsToGain(chainSettings.peakGainInDecibels);
-        if (std::abs(gain - 1.0f) < 1e-5f)
-            gain = 1.0f;
-
-        return juce::dsp::IIR::Coefficients<float>::makePeakFilter(sampleRate,
-                                                                   clampedPeakFreq,
-                                                                   gain,
-                                                                   chainSettings.peakQuality);
-    }
-
-    void updateCoefficients(Coefficients &old, const Coefficients &replacements)
-    {
-        // Update the old coefficients to match the new ones by dereferencing the pointers
-        *old = *replacements;
-    }
 }
@@ -5,17 +5,6 @@
 namespace DSP
 {
 
-    //=====================================================================
-    // Enum for Slope Settings
-    //=====================================================================
-    enum Slope
-    {
-        Slope_12,
-        Slope_24,
-        Slope_36,
-        Slope_48
-    };
-
     //=====================================================================
     // Chain Settings Structure
     //=====================================================================
@@ -39,7 +28,6 @@ namespace DSP
     //=====================================================================
     // Filter Type Aliases
     //=====================================================================
-    using Filter = juce::dsp::IIR::Filter<float>;
     using CutFilter = juce::dsp::ProcessorChain<Filter, Filter, Filter, Filter>;
     using MonoChain = juce::dsp::ProcessorChain<CutFilter, Filter, CutFilter>;
 
@@ -53,70 +41,22 @@ namespace DSP
         HighCut
     };
 
-    using Coefficients = Filter::CoefficientsPtr;
-
     //=====================================================================
-    // DSP Utility Functions
+    // DSP Utility Functions (the filter design lives in the jb_dsp module)
     //=====================================================================
-    void updateCoefficients(Coefficients &old, const Coefficients &replacements);
-    Coefficients makePeakFilter(const ChainSettings &chainSettings, double sampleRate);
-
-    template <int Index, typename ChainType, typename CoefficientsType>
-    void update(ChainType &chain, const CoefficientsType &coefficients)
+    inline Coefficients makePeakFilter(const ChainSettings &chainSettings, double sampleRate)
     {
-        updateCoefficients(chain.template get<Index>().coefficients, coefficients[Index]); // Update coefficients
-        chain.template setBypassed<Index>(false);                                          // Ensure the chain is active
-    }
-
-    template <typename ChainType, typename CoefficientsType>
-    void updateCutFilter(ChainType &chain, const CoefficientsType &coefficients, const Slope &slope)
-    {
-        // Bypass all filter stages initially
-        chain.template setBypassed<0>(true);
-        chain.template setBypassed<1>(true);
-        chain.template setBypassed<2>(true);
-        chain.template setBypassed<3>(true);
-
-        // Intentionally fall through to update the necessary stages based on the slope
-        switch (slope)
-        {
-        case Slope_48:
-            update<3>(chain, coefficients);
-            [[fallthrough]];
-        case Slope_36:
-            update<2>(chain, coefficients);
-            [[fallthrough]];
-        case Slope_24:
-            update<1>(chain, coefficients);
-            [[fallthrough]];
-        case Slope_12:
-            update<0>(chain, coefficients);
-            break;
-        }
+        return makePeakFilter(chainSettings.peakFreq, chainSettings.peakGainInDecibels, chainSettings.peakQuality, sampleRate);
     }
 
     inline auto makeLowCutFilter(const ChainSettings &chainSettings, double sampleRate)
     {
-        auto nyquist = static_cast<float>(sampleRate / 2.0);
-        // Clamp the low cut frequency to be at most 95% of Nyquist
-        float clampedLowCut = std::min(chainSettings.lowCutFreq, nyquist * 0.95f);
-
-        return juce::dsp::FilterDesign<float>::designIIRHighpassHighOrderButterworthMethod(
-            clampedLowCut,
-            sampleRate,
-            2 * (1 + static_cast<int>(chainSettings.lowCutSlope)));
+        return makeCutFilter(chainSettings.lowCutFreq, chainSettings.lowCutSlope, sampleRate, false);
     }
 
     inline auto makeHighCutFilter(const ChainSettings &chainSettings, double sampleRate)
     {
-        auto nyquist = static_cast<float>(sampleRate / 2.0);
-        // Clamp the high cut frequency to be at most 95% of Nyquist
-        float clampedHighCut = std::min(chainSettings.highCutFreq, nyquist * 0.95f);
-
-        return juce::dsp::FilterDesign<float>::designIIRLowpassHighOrderButterworthMethod(
-            clampedHighCut,
-            sampleRate,
-            2 * (1 + static_cast<int>(chainSettings.highCutSlope)));
+        return makeCutFilter(chainSettings.highCutFreq, chainSettings.highCutSlope, sampleRate, true);
     }
 
 } // namespace DSP
@@ -7,10 +7,6 @@ SimpleMIDIAudioProcessor::SimpleMIDIAudioProcessor()
     // register WAV/AIFF readers
     formatManager.registerBasicFormats();
 
-    // — add some sampler voices —
-    for (int i = 0; i < 8; ++i)
-        synth.addVoice(new juce::SamplerVoice());
-
     auto *wavData = BinaryData::piano_C4_wav;
     auto wavDataSize = BinaryData::piano_C4_wavSize;
 
@@ -24,7 +20,7 @@ SimpleMIDIAudioProcessor::SimpleMIDIAudioProcessor()
         juce::BigInteger allNotes;
         allNotes.setRange(0, 128, true);
 
-        synth.addSound(new juce::SamplerSound(
+        synth.addSound(new SampleSound(
             "Piano", *reader, allNotes, 60,
             0.0, // attack
             0.1, // release
@@ -35,6 +31,9 @@ SimpleMIDIAudioProcessor::SimpleMIDIAudioProcessor()
     {
         DBG("-- Failed to create reader from BinaryData --");
     }
+
+    // resample the piano to the session rate in prepareToPlay, not in every voice
+    synth.setResampleToPlaybackRate(true);
 }
 
 SimpleMIDIAudioProcessor::~SimpleMIDIAudioProcessor() = default;
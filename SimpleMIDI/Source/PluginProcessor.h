@@ -36,7 +36,7 @@ public:
   void setStateInformation(const void *, int) override {}
 
 private:
-  juce::Synthesiser synth;
+  PolySynthesiser synth{32};
   juce::AudioFormatManager formatManager;
 
   JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SimpleMIDIAudioProcessor)
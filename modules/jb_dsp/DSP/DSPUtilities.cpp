@@ -1,5 +1,3 @@
-#include "../DSP/DSPUtilities.h"
-
 namespace DSP
 {
 
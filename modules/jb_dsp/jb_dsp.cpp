@@ -0,0 +1,3 @@
+#include "jb_dsp.h"
+
+#include "DSP/DSPUtilities.cpp"
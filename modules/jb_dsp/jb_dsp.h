@@ -0,0 +1,26 @@
+/*******************************************************************************
+ The block below describes the properties of this module, and is read by
+ the Projucer to automatically generate project code that uses it.
+
+ BEGIN_JUCE_MODULE_DECLARATION
+
+  ID:                 jb_dsp
+  vendor:             JBlanked
+  version:            1.0.0
+  name:               JBlanked DSP utilities
+  description:        Filter design helpers and the analyser FIFO shared by the JBlanked equalizers.
+  website:            www.jblanked.com
+  minimumCppStandard: 17
+
+  dependencies:       juce_audio_basics juce_dsp
+
+ END_JUCE_MODULE_DECLARATION
+*******************************************************************************/
+
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <juce_dsp/juce_dsp.h>
+
+#include "DSP/Fifo.h"
+#include "DSP/DSPUtilities.h"
@@ -0,0 +1,246 @@
+#pragma once
+#include <array>
+#include <cmath>
+#include <memory>
+#include "WavWriter.h"
+
+/**
+ * Namespace providing utilities for creating and exporting short audio loops.
+ */
+namespace AudioLoopGenerator
+{
+    /**
+     * Band-limited oscillator built on a phase accumulator.
+     *
+     * Square and saw are corrected with PolyBLEP and the triangle with PolyBLAMP, so
+     * their edges don't alias; the sine is read from a shared wavetable.
+     */
+    class Oscillator
+    {
+    public:
+        /** Waveform selector: 0=Sine, 1=Square, 2=Saw, 3=Triangle. */
+        void setWaveform(int newWaveformType) { waveformType = newWaveformType; }
+
+        void setFrequency(double frequency, double sampleRate)
+        {
+            increment = juce::jlimit(0.0, 0.5, frequency / sampleRate);
+        }
+
+        void reset(double newPhase = 0.0) { phase = newPhase; }
+
+        /** Writes the next numSamples of the raw waveform (-1..1) to dest. */
+        void process(float *dest, int numSamples)
+        {
+            switch (waveformType)
+            {
+            case 1: // Square
+                run(dest, numSamples, [dt = increment](double t)
+                    { return (t < 0.5 ? 1.0 : -1.0) + polyBlep(t, dt) - polyBlep(wrap(t + 0.5), dt); });
+                break;
+
+            case 2: // Saw
+                run(dest, numSamples, [dt = increment](double t)
+                    { return 2.0 * t - 1.0 - polyBlep(t, dt); });
+                break;
+
+            case 3: // Triangle
+                run(dest, numSamples, [dt = increment](double t)
+                    { return (t < 0.5 ? 4.0 * t - 1.0 : 3.0 - 4.0 * t)
+                             + 8.0 * dt * (polyBlamp(t, dt) - polyBlamp(wrap(t + 0.5), dt)); });
+                break;
+
+            default: // Sine
+                run(dest, numSamples, [](double t)
+                    { return sineTable(t); });
+                break;
+            }
+        }
+
+    private:
+        template <typename Waveform>
+        void run(float *dest, int numSamples, Waveform waveform)
+        {
+            for (int i = 0; i < numSamples; ++i)
+            {
+                dest[i] = static_cast<float>(waveform(phase));
+                phase += increment;
+                if (phase >= 1.0)
+                    phase -= 1.0;
+            }
+        }
+
+        static double wrap(double t) { return t >= 1.0 ? t - 1.0 : t; }
+
+        // Polynomial correction for a step, spread over the sample either side of it
+        static double polyBlep(double t, double dt)
+        {
+            if (t < dt)
+            {
+                t /= dt;
+                return t + t - t * t - 1.0;
+            }
+            if (t > 1.0 - dt)
+            {
+                t = (t - 1.0) / dt;
+                return t * t + t + t + 1.0;
+            }
+            return 0.0;
+        }
+
+        // Integrated PolyBLEP: the same correction for a change of slope
+        static double polyBlamp(double t, double dt)
+        {
+            if (t < dt)
+            {
+                t = t / dt - 1.0;
+                return -t * t * t / 3.0;
+            }
+            if (t > 1.0 - dt)
+            {
+                t = (t - 1.0) / dt + 1.0;
+                return t * t * t / 3.0;
+            }
+            return 0.0;
+        }
+
+        // One cycle of sine, linearly interpolated; built once and shared by every oscillator
+        static double sineTable(double t)
+        {
+            constexpr int tableSize = 2048;
+            static const auto table = []
+            {
+                std::array<float, tableSize + 1> values{};
+                for (int i = 0; i <= tableSize; ++i)
+                    values[(size_t)i] = static_cast<float>(std::sin(2.0 * juce::MathConstants<double>::pi * i / tableSize));
+                return values;
+            }();
+
+            const double pos = t * tableSize;
+            const int index = static_cast<int>(pos);
+            const double frac = pos - index;
+            return table[(size_t)index] + frac * (table[(size_t)index + 1] - table[(size_t)index]);
+        }
+
+        int waveformType = 0;
+        double phase = 0.0;
+        double increment = 0.0;
+    };
+
+    /**
+     * Applies the loop's rhythmic envelope (a decaying accent on every beat) and
+     * output gain to samples, in place.
+     *
+     * The decay is computed once per beat and then stepped by a constant factor, so
+     * there is a single std::exp per beat instead of one per sample.
+     *
+     * @param startSample  Position of data[0] in the loop, so consecutive blocks line up.
+     */
+    inline void applyBeatEnvelope(float *data, int numSamples, juce::int64 startSample, double sampleRate, float bpm)
+    {
+        const double samplesPerBeat = sampleRate * 60.0 / bpm;
+        const double decayPerSample = std::exp(-4.0 / samplesPerBeat);
+
+        for (int i = 0; i < numSamples;)
+        {
+            // This beat runs from the current sample up to the start of the next one
+            const double beatPosition = (startSample + i) / samplesPerBeat;
+            const double beatIndex = std::floor(beatPosition);
+            const auto nextBeat = static_cast<juce::int64>(std::ceil((beatIndex + 1.0) * samplesPerBeat));
+            const int end = static_cast<int>(juce::jlimit<juce::int64>(i + 1, numSamples, nextBeat - startSample));
+
+            double decay = std::exp(-(beatPosition - beatIndex) * 4.0);
+            for (; i < end; ++i)
+            {
+                data[i] *= 0.5f * static_cast<float>(0.7 + 0.3 * decay);
+                decay *= decayPerSample;
+            }
+        }
+    }
+
+    /**
+     * Generates an audio loop buffer of a specified waveform and rhythmic envelope.
+     *
+     * Every channel carries the same signal, so one channel is rendered and copied
+     * to the others.
+     *
+     * @param frequency           Base frequency (Hz) of the oscillator.
+     * @param lengthInSamples     Total length of the loop in samples.
+     * @param sampleRate          Sample rate to use (Hz).
+     * @param bpm                 Tempo in beats per minute for envelope modulation.
+     * @param waveformType        Waveform selector: 0=Sine, 1=Square, 2=Saw, 3=Triangle.
+     * @param numChannels         Number of audio channels to generate.
+     * @return                    An AudioBuffer<float> containing the multi-channel loop.
+     */
+    inline juce::AudioBuffer<float> generateAudioLoop(float frequency,
+                                                      int lengthInSamples,
+                                                      double sampleRate,
+                                                      float bpm,
+                                                      int waveformType,
+                                                      int numChannels)
+    {
+        // Prepare multi-channel buffer
+        juce::AudioBuffer<float> buffer(numChannels, lengthInSamples);
+        if (numChannels == 0 || lengthInSamples == 0)
+            return buffer;
+
+        Oscillator oscillator;
+        oscillator.setWaveform(waveformType);
+        oscillator.setFrequency(frequency, sampleRate);
+
+        float *channelData = buffer.getWritePointer(0);
+        oscillator.process(channelData, lengthInSamples);
+        applyBeatEnvelope(channelData, lengthInSamples, 0, sampleRate, bpm);
+
+        for (int channel = 1; channel < numChannels; ++channel)
+            buffer.copyFrom(channel, 0, buffer, 0, 0, lengthInSamples);
+
+        return buffer;
+    }
+
+    /**
+     * Renders the same loop as generateAudioLoop and writes it to a WAV stream a
+     * block at a time, so however long the loop is, only one block of samples is
+     * ever held in memory.
+     *
+     * @param stream              Where to write the WAV file, e.g. a FileOutputStream.
+     * @param frequency           Base frequency (Hz) of the oscillator.
+     * @param lengthInSamples     Total length of the loop in samples.
+     * @param sampleRate          Sample rate to use (Hz).
+     * @param bpm                 Tempo in beats per minute for envelope modulation.
+     * @param waveformType        Waveform selector: 0=Sine, 1=Square, 2=Saw, 3=Triangle.
+     * @param numChannels         Number of audio channels to generate.
+     * @param bitsPerSample       16 or 24 for integer samples, 32 for floating point.
+     * @return                    true if the whole file was written.
+     */
+    inline bool writeWavFile(std::unique_ptr<juce::OutputStream> stream,
+                             float frequency,
+                             int lengthInSamples,
+                             double sampleRate,
+                             float bpm,
+                             int waveformType,
+                             int numChannels,
+                             int bitsPerSample)
+    {
+        Oscillator oscillator;
+        oscillator.setWaveform(waveformType);
+        oscillator.setFrequency(frequency, sampleRate);
+
+        return WavWriter::writeWavFile(std::move(stream),
+                                       lengthInSamples,
+                                       numChannels,
+                                       sampleRate,
+                                       bitsPerSample,
+                                       [&](juce::AudioBuffer<float> &block, int start)
+                                       {
+                                           // The oscillator keeps its phase and the envelope follows start, so the
+                                           // blocks join up exactly as in one long render
+                                           const int numSamples = block.getNumSamples();
+                                           float *channelData = block.getWritePointer(0);
+                                           oscillator.process(channelData, numSamples);
+                                           applyBeatEnvelope(channelData, numSamples, start, sampleRate, bpm);
+
+                                           for (int channel = 1; channel < numChannels; ++channel)
+                                               block.copyFrom(channel, 0, block, 0, 0, numSamples);
+                                       });
+    }
+}
@@ -0,0 +1,202 @@
+#pragma once
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+class DraggableLoopComponent : public juce::Component
+{
+public:
+    DraggableLoopComponent(const juce::String &name, const juce::Colour &color)
+        : name(name), color(color)
+    {
+        setMouseCursor(juce::MouseCursor::DraggingHandCursor);
+    }
+
+    ~DraggableLoopComponent()
+    {
+        // Let a write in progress finish, then remove every file this component created
+        writer.removeAllJobs(true, 5000);
+        for (auto &tempFile : tempFiles)
+            if (tempFile->createdHere)
+                tempFile->file.deleteFile();
+    }
+
+    void paint(juce::Graphics &g)
+    {
+        // Create a rounded-rectangle background
+        g.setColour(color);
+        g.fillRoundedRectangle(getLocalBounds().toFloat(), 10.0f);
+
+        // Add text
+        g.setColour(juce::Colours::white);
+        g.setFont(14.0f);
+        g.drawText(name, getLocalBounds(), juce::Justification::centred);
+
+        // Add instruction text
+        g.setFont(10.0f);
+        const bool preparing = current != nullptr && !isReady();
+        g.drawText(preparing ? "Preparing..." : "Drag me to your DAW", getLocalBounds().removeFromBottom(15),
+                   juce::Justification::centredBottom);
+    }
+
+    void mouseDown(const juce::MouseEvent &e)
+    {
+        // check if we have data, and that its file is written: the message thread
+        // never waits for the writer, so a drag starts only once the file is there
+        if (!isReady() || !current->ok)
+        {
+            return;
+        }
+
+        // Another instance with the same loop may have removed the shared file:
+        // write it again, and the tile is draggable once it's back
+        if (!current->file.existsAsFile())
+        {
+            startWrite(current);
+            return;
+        }
+
+        current->dragged = true;
+
+        juce::StringArray files;
+        files.add(current->file.getFullPathName());
+        juce::DragAndDropContainer *dragContainer = juce::DragAndDropContainer::findParentDragContainerFor(this);
+        if (dragContainer != nullptr)
+        {
+            dragContainer->performExternalDragDropOfFiles(files, true);
+        }
+        else
+        {
+            juce::Component *parent = getParentComponent();
+            if (parent != nullptr)
+            {
+                current->file.revealToUser();
+            }
+        }
+    }
+
+    void mouseDrag(const juce::MouseEvent &e)
+    {
+        // Already handled by mouseDown
+    }
+
+    void setLoopData(const juce::MemoryBlock &data, const juce::String &format)
+    {
+        auto tempFile = std::make_shared<TempFile>();
+        tempFile->data = std::make_shared<const juce::MemoryBlock>(data);
+        tempFile->format = format;
+        tempFiles.push_back(tempFile);
+        current = tempFile;
+        startWrite(tempFile);
+    }
+
+private:
+    // A loop's file in the temp directory, named after a hash of its contents so the
+    // same loop is only ever written once
+    struct TempFile
+    {
+        std::shared_ptr<const juce::MemoryBlock> data; // kept while it's the current loop, to rewrite a lost file
+        juce::String format;
+        juce::File file;
+        bool ok = false;
+        bool createdHere = false;
+        bool dragged = false; // a host may still be reading it, so it stays until we're deleted
+        juce::WaitableEvent written{true};
+    };
+
+    bool isReady() const { return current != nullptr && current->written.wait(0); }
+
+    // Writes the file in the background, ready for the first drag, then shows it's ready
+    void startWrite(std::shared_ptr<TempFile> tempFile)
+    {
+        tempFile->written.reset();
+        repaint();
+
+        writer.addJob([tempFile, baseName = name.replaceCharacter(' ', '_'),
+                       safeThis = juce::Component::SafePointer<DraggableLoopComponent>(this)]
+                      {
+                          writeTempFile(*tempFile, baseName);
+                          juce::MessageManager::callAsync([safeThis, tempFile]
+                                                          {
+                                                              if (safeThis != nullptr)
+                                                                  safeThis->writeFinished(tempFile);
+                                                          });
+                      });
+    }
+
+    void writeFinished(const std::shared_ptr<TempFile> &tempFile)
+    {
+        // Older loops are only let go once the newest is on disk and its path is known,
+        // so setting the same loop again never deletes the file it's about to reuse
+        if (tempFile == current && isReady())
+            removeSupersededFiles();
+        repaint();
+    }
+
+    // Forgets the older loops once they're written. Files that were dragged out are
+    // kept, as a host may refer to them, and so is any file the current loop shares
+    void removeSupersededFiles()
+    {
+        auto isKept = [this](const std::shared_ptr<TempFile> &tempFile)
+        { return tempFile == current || tempFile->dragged || !tempFile->written.wait(0); };
+
+        std::vector<std::shared_ptr<TempFile>> kept;
+        for (auto &tempFile : tempFiles)
+            if (isKept(tempFile))
+                kept.push_back(tempFile);
+
+        for (auto &tempFile : tempFiles)
+        {
+            if (isKept(tempFile))
+                continue;
+
+            auto sharer = std::find_if(kept.begin(), kept.end(), [&](const std::shared_ptr<TempFile> &other)
+                                       { return other->file == tempFile->file; });
+            if (sharer != kept.end())
+                (*sharer)->createdHere = (*sharer)->createdHere || tempFile->createdHere;
+            else if (tempFile->createdHere)
+                tempFile->file.deleteFile();
+        }
+
+        // Only the current loop can need rewriting
+        for (auto &tempFile : kept)
+            if (tempFile != current && tempFile->written.wait(0))
+                tempFile->data.reset();
+
+        tempFiles = std::move(kept);
+    }
+
+    static void writeTempFile(TempFile &tempFile, const juce::String &baseName)
+    {
+        const auto &data = *tempFile.data;
+
+        // 64-bit FNV-1a over the file contents
+        juce::uint64 hash = 14695981039346656037ull;
+        auto *bytes = static_cast<const juce::uint8 *>(data.getData());
+        for (size_t i = 0; i < data.getSize(); ++i)
+            hash = (hash ^ bytes[i]) * 1099511628211ull;
+
+        tempFile.file = juce::File::getSpecialLocation(juce::File::tempDirectory)
+                            .getChildFile(baseName + "_" + juce::String::toHexString((juce::int64)hash) + "." + tempFile.format);
+
+        if (tempFile.file.existsAsFile() && tempFile.file.getSize() == (juce::int64)data.getSize())
+        {
+            tempFile.ok = true;
+        }
+        else
+        {
+            tempFile.ok = tempFile.file.replaceWithData(data.getData(), data.getSize());
+            tempFile.createdHere = tempFile.createdHere || tempFile.ok;
+        }
+
+        tempFile.written.signal();
+    }
+
+    juce::String name;
+    juce::Colour color;
+    std::shared_ptr<TempFile> current;
+    std::vector<std::shared_ptr<TempFile>> tempFiles;
+    juce::ThreadPool writer{1};
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DraggableLoopComponent)
+};
@@ -1,6 +1,5 @@
 #pragma once
-#include <JuceHeader.h>
-#include <cmath>
+#include "MidiNoteHandler.h"
 
 /**
  * Namespace providing utilities for creating and exporting short MIDI loops.
@@ -23,8 +22,8 @@ namespace MidiLoopGenerator
         juce::MidiMessageSequence sequence;
         sequence.clear();
 
-        // Calculate MIDI note (69 = A4 = 440 Hz)
-        int midiNote = static_cast<int>(std::round(69.0 + 12.0 * std::log2(frequency / 440.0)));
+        // Nearest MIDI note (69 = A4 = 440 Hz), from the precomputed note boundaries
+        int midiNote = juce::jmax(0, MidiNoteHandler::frequencyToMidiNote(frequency));
         const double ticksPerQuarter = 960.0;
 
         for (int bar = 0; bar < numBars; ++bar)
@@ -1,8 +1,7 @@
 #pragma once
-#include <JuceHeader.h>
-#include <cmath>
-#include <limits>
-#include <map>
+#include <algorithm>
+#include <array>
+#include <cstdint>
 
 namespace MidiNoteHandler
 {
@@ -144,13 +143,13 @@ namespace MidiNoteHandler
         G9s // G# / Ab
     } NoteName;
 
+    static constexpr int numNoteNames = G9s + 1;
+
     /**
-     * @brief Converts a NoteName enum value to its corresponding MIDI note number.
-     * @param note The NoteName enum value.
-     * @return The MIDI note number (0-127), or -1 if the NoteName corresponds
-     *         to a note outside the standard MIDI range or is otherwise invalid.
+     * @brief The NoteName -> MIDI number mapping that noteToMidiTable is built from at
+     * compile time. Call noteToMidiNote instead.
      */
-    inline constexpr int noteToMidiNote(NoteName note)
+    inline constexpr int computeMidiNote(NoteName note)
     {
         // Standard MIDI notes: C4 = 60, A4 = 69
         switch (note)
@@ -445,6 +444,102 @@ namespace MidiNoteHandler
         }
     }
 
+    namespace detail
+    {
+        // 2^(k/12) for the 12 semitones of an octave
+        constexpr double semitoneRatios[12] = {
+            1.0, 1.0594630943592953, 1.122462048309373, 1.189207115002721,
+            1.2599210498948732, 1.3348398541700344, 1.4142135623730951, 1.4983070768766815,
+            1.5874010519681994, 1.681792830507429, 1.7817974362806785, 1.8877486253633868};
+
+        // Frequency of MIDI note 0 (C-1) with A4 = 440Hz, i.e. 440 * 2^(-69/12)
+        constexpr double midiNoteZeroFrequency = 8.175798915643707;
+
+        constexpr double frequencyOf(int midiNote)
+        {
+            return midiNoteZeroFrequency * static_cast<double>(1 << (midiNote / 12)) * semitoneRatios[midiNote % 12];
+        }
+    }
+
+    /**
+     * @brief NoteName -> MIDI note number (-1 for notes outside the MIDI range), built at compile time.
+     */
+    inline constexpr auto noteToMidiTable = []
+    {
+        std::array<std::int8_t, numNoteNames> table{};
+        for (int i = 0; i < numNoteNames; ++i)
+            table[(size_t)i] = static_cast<std::int8_t>(computeMidiNote(static_cast<NoteName>(i)));
+        return table;
+    }();
+
+    /**
+     * @brief MIDI note number -> frequency in Hz (A4 = 440Hz), built at compile time.
+     */
+    inline constexpr auto midiToFrequencyTable = []
+    {
+        std::array<float, 128> table{};
+        for (int i = 0; i < 128; ++i)
+            table[(size_t)i] = static_cast<float>(detail::frequencyOf(i));
+        return table;
+    }();
+
+    /**
+     * @brief MIDI note number -> NoteName (-1 where no NoteName exists), built at compile time.
+     * Where several names share a MIDI number (e.g. F4 and E4s), the first in the order
+     * A, B, C, D, E, F, G, then A#, C#, D#, E#, F#, G# wins.
+     */
+    inline constexpr auto midiToNoteTable = []
+    {
+        constexpr NoteName namesInPriorityOrder[] = {
+            A0, A1, A2, A3, A4, A5, A6, A7, A8, A9,
+            B0, B1, B2, B3, B4, B5, B6, B7, B8, B9,
+            C0, C1, C2, C3, C4, C5, C6, C7, C8, C9,
+            D0, D1, D2, D3, D4, D5, D6, D7, D8, D9,
+            E0, E1, E2, E3, E4, E5, E6, E7, E8, E9,
+            F0, F1, F2, F3, F4, F5, F6, F7, F8, F9,
+            G0, G1, G2, G3, G4, G5, G6, G7, G8, G9,
+            A0s, A1s, A2s, A3s, A4s, A5s, A6s, A7s, A8s, A9s,
+            C1s, C2s, C3s, C4s, C5s, C6s, C7s, C8s, C9s,
+            D0s, D1s, D2s, D3s, D4s, D5s, D6s, D7s, D8s, D9s,
+            E0s, E1s, E2s, E3s, E4s, E5s, E6s, E7s, E8s, E9s,
+            F0s, F1s, F2s, F3s, F4s, F5s, F6s, F7s, F8s, F9s,
+            G0s, G1s, G2s, G3s, G4s, G5s, G6s, G7s, G8s, G9s};
+
+        std::array<std::int16_t, 128> table{};
+        for (auto &entry : table)
+            entry = -1;
+        for (NoteName note : namesInPriorityOrder)
+        {
+            const int midiNote = computeMidiNote(note);
+            if (midiNote >= 0 && table[(size_t)midiNote] < 0)
+                table[(size_t)midiNote] = static_cast<std::int16_t>(note);
+        }
+        return table;
+    }();
+
+    /**
+     * @brief The frequencies halfway (in pitch) between neighbouring MIDI notes: any
+     * frequency below entry n rounds to MIDI note n or lower. Built at compile time.
+     */
+    inline constexpr auto midiNoteBoundaryTable = []
+    {
+        constexpr double quarterToneRatio = 1.029302236643492; // 2^(1/24)
+        std::array<double, 127> table{};
+        for (int i = 0; i < 127; ++i)
+            table[(size_t)i] = detail::frequencyOf(i) * quarterToneRatio;
+        return table;
+    }();
+
+    /**
+     * @brief Converts a NoteName enum value to its corresponding MIDI note number.
+     * @param note The NoteName enum value.
+     * @return The MIDI note number (0-127), or -1 if the NoteName corresponds
+     *         to a note outside the standard MIDI range or is otherwise invalid.
+     */
+    inline constexpr int noteToMidiNote(NoteName note)
+    {
+        return (note >= 0 && note < numNoteNames) ? noteToMidiTable[(size_t)note] : -1;
+    }
     /**
      * @brief Converts a MIDI note number to its corresponding frequency in Hz.
      *        Uses the standard A4=440Hz tuning.
@@ -457,8 +552,7 @@ namespace MidiNoteHandler
         {
             return 0.0f; // Invalid MIDI note
         }
-        // Formula: freq = 440 * 2^((midiNote - 69) / 12)
-        return 440.0f * std::pow(2.0f, (static_cast<float>(midiNote) - 69.0f) / 12.0f);
+        return midiToFrequencyTable[(size_t)midiNote];
     }
 
     /**
@@ -482,17 +576,10 @@ namespace MidiNoteHandler
         {
             return -1; // Invalid frequency
         }
-        // Formula: midiNote = 12 * log2(freq / 440) + 69
-        // Use std::round for nearest integer MIDI note.
-        double midiNoteDouble = 12.0 * std::log2(static_cast<double>(frequency) / 440.0) + 69.0;
-        int midiNote = static_cast<int>(std::round(midiNoteDouble));
-
-        // Clamp to valid MIDI range [0, 127]
-        if (midiNote < 0)
-            return 0;
-        if (midiNote > 127)
-            return 127;
-        return midiNote;
+        // Count the note boundaries at or below the frequency: the same as rounding
+        // 12 * log2(freq / 440) + 69, clamped to [0, 127], without the log2
+        const auto &bounds = midiNoteBoundaryTable;
+        return static_cast<int>(std::upper_bound(bounds.begin(), bounds.end(), static_cast<double>(frequency)) - bounds.begin());
     }
 
     /**
@@ -519,52 +606,10 @@ namespace MidiNoteHandler
             return A4; // Handle invalid frequency by returning a default
         }
 
-        // Build a reverse map (MIDI note -> NoteName) for efficient lookup.
-        // Static initialization ensures this is built only once.
-        static const std::map<int, NoteName> midiToNoteMap = []
-        {
-            std::map<int, NoteName> map;
-            // Iterate through a representative range of the enum.
-            // Assuming NoteName values might not be perfectly contiguous.
-            // Need to manually list notes or iterate carefully if enum values have large gaps.
-            // Let's iterate based on known structure C0 to G9s range approximately.
-            NoteName allNotes[] = {
-                A0, A1, A2, A3, A4, A5, A6, A7, A8, /*A9,*/
-                B0, B1, B2, B3, B4, B5, B6, B7, B8, /*B9,*/
-                C0, C1, C2, C3, C4, C5, C6, C7, C8, C9,
-                D0, D1, D2, D3, D4, D5, D6, D7, D8, D9,
-                E0, E1, E2, E3, E4, E5, E6, E7, E8, E9,
-                F0, F1, F2, F3, F4, F5, F6, F7, F8, F9,
-                G0, G1, G2, G3, G4, G5, G6, G7, G8, G9,
-                A0s, A1s, A2s, A3s, A4s, A5s, A6s, A7s, A8s, /*A9s,*/
-                C1s, C2s, C3s, C4s, C5s, C6s, C7s, C8s, C9s,
-                D0s, D1s, D2s, D3s, D4s, D5s, D6s, D7s, D8s, D9s,
-                E0s, E1s, E2s, E3s, E4s, E5s, E6s, E7s, E8s, E9s,
-                F0s, F1s, F2s, F3s, F4s, F5s, F6s, F7s, F8s, F9s,
-                G0s, G1s, G2s, G3s, G4s, G5s, G6s, G7s, G8s /*G9s*/
-            };
-
-            for (NoteName note : allNotes)
-            {
-                int midiNote = noteToMidiNote(note);
-                if (midiNote >= 0)
-                {
-                    // If MIDI note not already in map, add it.
-                    // This prioritizes the first NoteName encountered for a given MIDI note
-                    // (e.g., F4 might be added before E4s).
-                    if (map.find(midiNote) == map.end())
-                    {
-                        map[midiNote] = note;
-                    }
-                }
-            }
-            return map;
-        }();
-
-        auto it = midiToNoteMap.find(targetMidiNote);
-        if (it != midiToNoteMap.end())
+        const int note = midiToNoteTable[(size_t)targetMidiNote];
+        if (note >= 0)
         {
-            return it->second; // Found a matching NoteName
+            return static_cast<NoteName>(note); // Found a matching NoteName
         }
 
         // Fallback if no NoteName in our map corresponds to the target MIDI note
@@ -0,0 +1,292 @@
+#include "MidiToAudio.h"
+#include <algorithm>
+
+namespace MidiToAudio
+{
+    /**
+     * Lays out one sample hit per note of a pattern. Every render comes through here.
+     *
+     * @param pattern     The notes to render, with their step grid and swing.
+     * @param data        Pointer to the binary WAV data for the sample.
+     * @param dataSize    Size of the binary data in bytes.
+     * @param bpm         Tempo in beats per minute.
+     * @param sampleRate  Sample rate of the render in Hz.
+     * @param groove      Timing and velocity humanisation (default = none).
+     */
+    HitList prepareHits(
+        const RhythmGenerator::Pattern &pattern,
+        const void *data,
+        size_t dataSize,
+        float bpm,
+        double sampleRate,
+        const Groove &groove)
+    {
+        HitList result;
+        int samplesPerBeat = static_cast<int>(sampleRate * 60.0 / bpm);
+
+        // Decode the sample once for the whole loop (and reuse it across renders)
+        const auto sample = SampleLoopGenerator::getDecodedSample(data, dataSize);
+
+        // Limit maximum note duration to one step to prevent overlapping hits
+        const double samplesPerStep = static_cast<double>(samplesPerBeat) / pattern.stepsPerBeat;
+        result.maxLength = samplesPerBeat / pattern.stepsPerBeat;
+        result.fadeSamples = static_cast<int>(sampleRate * hitFadeSeconds);
+
+        // Every note draws both offsets, so changing one amount doesn't reshuffle the other
+        juce::Random random(groove.seed);
+        const double maxTimingOffset = groove.timingMs * 0.001 * sampleRate;
+
+        result.hits.reserve(pattern.notes.size());
+        for (const auto &event : pattern.notes)
+        {
+            // Swing moves where the note starts and ends; humanising shifts the whole hit
+            const double start = pattern.getStepPosition(event.startStep);
+            const double end = pattern.getStepPosition(event.startStep + event.lengthSteps);
+            const double timingOffset = maxTimingOffset * (2.0 * random.nextDouble() - 1.0);
+            const float humanise = 1.0f + groove.velocity * (2.0f * random.nextFloat() - 1.0f);
+
+            Hit hit;
+            hit.startSample = juce::jmax(0, static_cast<int>(start * samplesPerStep + timingOffset));
+            hit.lengthInSamples = juce::jmin(static_cast<int>((end - start) * samplesPerStep), result.maxLength);
+            hit.gain = juce::jmax(0.0f, velocityToGain(event.velocity) * humanise);
+            if (hit.lengthInSamples <= 0 || hit.gain <= 0.0f)
+                continue;
+
+            // Repitched once per pitch, and shared with earlier renders
+            hit.sample = SampleLoopGenerator::getRepitchedSample(sample, MidiNoteHandler::midiNoteToFrequency(event.midiNote));
+            result.hits.push_back(std::move(hit));
+        }
+
+        // Timing offsets can swap neighbouring hits
+        std::stable_sort(result.hits.begin(), result.hits.end(),
+                         [](const Hit &a, const Hit &b)
+                         { return a.startSample < b.startSample; });
+
+        return result;
+    }
+
+    /**
+     * Mixes the hits that reach into output, which holds the loop from sample
+     * bufferStart on.
+     *
+     * @param output      Buffer to mix into (all of its channels are used).
+     * @param bufferStart Sample of the loop that output starts at.
+     * @param hits        The hits from prepareHits.
+     */
+    void addToBuffer(
+        juce::AudioBuffer<float> &output,
+        int bufferStart,
+        const HitList &hits)
+    {
+        const int bufferEnd = bufferStart + output.getNumSamples();
+
+        // No hit is longer than maxLength, so earlier ones have ended before output starts
+        auto hit = std::lower_bound(hits.hits.begin(), hits.hits.end(), bufferStart - hits.maxLength + 1,
+                                    [](const Hit &h, int sample)
+                                    { return h.startSample < sample; });
+
+        // Mix each hit straight into the output (no per-note buffers), fading out
+        // its end to avoid abrupt artifacts
+        for (; hit != hits.hits.end() && hit->startSample < bufferEnd; ++hit)
+            SampleLoopGenerator::addRepitchedHit(output,
+                                                 hit->startSample - bufferStart,
+                                                 hit->lengthInSamples,
+                                                 *hit->sample,
+                                                 juce::jmin(hit->lengthInSamples, hits.fadeSamples),
+                                                 hit->gain);
+    }
+
+    /**
+     * Renders a pattern of any length and resolution into an audio buffer, mixing
+     * one sample hit per note.
+     *
+     * @param pattern     The notes to render, with their step grid and swing.
+     * @param data        Pointer to the binary WAV data for the sample.
+     * @param dataSize    Size of the binary data in bytes.
+     * @param bpm         Tempo in beats per minute.
+     * @param numChannels Number of audio channels (default = 2).
+     * @param sampleRate  Sample rate in Hz (default = 44100.0).
+     * @param groove      Timing and velocity humanisation (default = none).
+     * @return            An AudioBuffer<float> containing the rendered audio.
+     */
+    juce::AudioBuffer<float> convert(
+        const RhythmGenerator::Pattern &pattern,
+        const void *data,
+        size_t dataSize,
+        float bpm,
+        int numChannels,
+        double sampleRate,
+        const Groove &groove)
+    {
+        // 1) Compute loop length in samples
+        int samplesPerBeat = static_cast<int>(sampleRate * 60.0 / bpm);
+        int totalSamples = samplesPerBeat * pattern.getNumBeats();
+
+        // 2) Prepare output buffer
+        juce::AudioBuffer<float> output(numChannels, totalSamples);
+        output.clear();
+
+        // 3) Mix the notes in
+        addToBuffer(output, 0, prepareHits(pattern, data, dataSize, bpm, sampleRate, groove));
+        return output;
+    }
+
+    /**
+     * Converts a rhythmic Loop8 structure and sample data into an audio buffer by
+     * rendering each note with the provided sample.
+     *
+     * @param loop        The RhythmGenerator::Loop8 struct defining the rhythm.
+     * @param data        Pointer to the binary WAV data for the sample.
+     * @param dataSize    Size of the binary data in bytes.
+     * @param bpm         Tempo in beats per minute.
+     * @param numChannels Number of audio channels (default = 2).
+     * @param sampleRate  Sample rate in Hz (default = 44100.0).
+     * @return            An AudioBuffer<float> containing the rendered audio.
+     */
+    juce::AudioBuffer<float> convert(
+        const RhythmGenerator::Loop8 &loop,
+        const void *data,
+        size_t dataSize,
+        float bpm,
+        int numChannels,
+        double sampleRate)
+    {
+        return convert(RhythmGenerator::toPattern(loop), data, dataSize, bpm, numChannels, sampleRate);
+    }
+
+    /**
+     * Converts a rhythmic Loop16 structure and sample data into an audio buffer by
+     * rendering each note with the provided sample. Handles 16th note resolution.
+     *
+     * @param loop        The RhythmGenerator::Loop16 struct defining the rhythm.
+     * @param data        Pointer to the binary WAV data for the sample.
+     * @param dataSize    Size of the binary data in bytes.
+     * @param bpm         Tempo in beats per minute.
+     * @param numChannels Number of audio channels (default = 2).
+     * @param sampleRate  Sample rate in Hz (default = 44100.0).
+     * @return            An AudioBuffer<float> containing the rendered audio.
+     */
+    juce::AudioBuffer<float> convert(
+        const RhythmGenerator::Loop16 &loop,
+        const void *data,
+        size_t dataSize,
+        float bpm,
+        int numChannels,
+        double sampleRate)
+    {
+        return convert(RhythmGenerator::toPattern(loop), data, dataSize, bpm, numChannels, sampleRate);
+    }
+
+    /**
+     * Renders a pattern of any length and resolution with the provided sample and
+     * encodes it as a WAV file.
+     *
+     * @param pattern     The notes to render, with their step grid and swing.
+     * @param data        Pointer to the binary WAV data for the sample.
+     * @param dataSize    Size of the binary data in bytes.
+     * @param bpm         Tempo in beats per minute.
+     * @param numChannels Number of audio channels (default = 2).
+     * @param sampleRate  Sample rate in Hz (default = 44100.0).
+     * @param groove      Timing and velocity humanisation (default = none).
+     * @return            A MemoryBlock containing the WAV file data.
+     */
+    juce::MemoryBlock convertToWavFile(
+        const RhythmGenerator::Pattern &pattern,
+        const void *data,
+        size_t dataSize,
+        float bpm,
+        int numChannels,
+        double sampleRate,
+        const Groove &groove)
+    {
+        juce::AudioBuffer<float> audioLoop = convert(
+            pattern, data, dataSize, bpm, numChannels, sampleRate, groove);
+        return WavWriter::createWavFile(audioLoop, sampleRate);
+    }
+
+    /**
+     * Converts a rhythmic Loop8 structure and sample data into an audio buffer by
+     * rendering each MIDI note with the provided sample.
+     *
+     * @param loop        The RhythmGenerator::Loop8 struct defining the rhythm.
+     * @param data        Pointer to the binary WAV data for the sample.
+     * @param dataSize    Size of the binary data in bytes.
+     * @param bpm         Tempo in beats per minute.
+     * @param numChannels Number of audio channels (default = 2).
+     * @param sampleRate  Sample rate in Hz (default = 44100.0).
+     * @return            A MemoryBlock containing the WAV file data.
+     */
+    juce::MemoryBlock convertToWavFile(
+        const RhythmGenerator::Loop8 &loop,
+        const void *data,
+        size_t dataSize,
+        float bpm,
+        int numChannels,
+        double sampleRate)
+    {
+        return convertToWavFile(RhythmGenerator::toPattern(loop), data, dataSize, bpm, numChannels, sampleRate);
+    }
+
+    /**
+     * Converts a rhythmic Loop16 structure and sample data into an audio buffer by
+     * rendering each MIDI note with the provided sample. Handles 16th note resolution.
+     *
+     * @param loop        The RhythmGenerator::Loop16 struct defining the rhythm.
+     * @param data        Pointer to the binary WAV data for the sample.
+     * @param dataSize    Size of the binary data in bytes.
+     * @param bpm         Tempo in beats per minute.
+     * @param numChannels Number of audio channels (default = 2).
+     * @param sampleRate  Sample rate in Hz (default = 44100.0).
+     * @return            A MemoryBlock containing the WAV file data.
+     */
+    juce::MemoryBlock convertToWavFile(
+        const RhythmGenerator::Loop16 &loop,
+        const void *data,
+        size_t dataSize,
+        float bpm,
+        int numChannels,
+        double sampleRate)
+    {
+        return convertToWavFile(RhythmGenerator::toPattern(loop), data, dataSize, bpm, numChannels, sampleRate);
+    }
+
+    /**
+     * Renders a pattern with the provided sample and writes it to a WAV stream a
+     * block at a time, so a long render never sits in memory as a whole.
+     *
+     * @param stream        Where to write the WAV file, e.g. a FileOutputStream.
+     * @param pattern       The notes to render, with their step grid and swing.
+     * @param data          Pointer to the binary WAV data for the sample.
+     * @param dataSize      Size of the binary data in bytes.
+     * @param bpm           Tempo in beats per minute.
+     * @param numChannels   Number of audio channels.
+     * @param sampleRate    Sample rate in Hz.
+     * @param bitsPerSample 16 or 24 for integer samples, 32 for floating point.
+     * @param groove        Timing and velocity humanisation (default = none).
+     * @return              true if the whole file was written.
+     */
+    bool writeWavFile(
+        std::unique_ptr<juce::OutputStream> stream,
+        const RhythmGenerator::Pattern &pattern,
+        const void *data,
+        size_t dataSize,
+        float bpm,
+        int numChannels,
+        double sampleRate,
+        int bitsPerSample,
+        const Groove &groove)
+    {
+        // Same length as convert
+        int samplesPerBeat = static_cast<int>(sampleRate * 60.0 / bpm);
+        const auto hits = prepareHits(pattern, data, dataSize, bpm, sampleRate, groove);
+
+        return WavWriter::writeWavFile(std::move(stream),
+                                       samplesPerBeat * pattern.getNumBeats(),
+                                       numChannels,
+                                       sampleRate,
+                                       bitsPerSample,
+                                       [&](juce::AudioBuffer<float> &block, int blockStart)
+                                       { addToBuffer(block, blockStart, hits); });
+    }
+
+} // namespace MidiToAudio
\ No newline at end of file
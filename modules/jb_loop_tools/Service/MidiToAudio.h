@@ -0,0 +1,254 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "RhythmGenerator.h"
+#include "SampleLoopGenerator.h"
+#include "MidiNoteHandler.h"
+#include "WavWriter.h"
+
+namespace MidiToAudio
+{
+    /**
+     * Humanisation applied to each hit as it's mixed. Each note draws its offsets
+     * from a Random seeded with seed, so the same groove always sounds the same,
+     * and a different seed gives another take of the same pattern.
+     */
+    struct Groove
+    {
+        double timingMs = 0.0; // how far a hit may land either side of its step, in ms
+        float velocity = 0.0f; // how far a hit's level may stray, as a fraction (0.2 = +/-20%)
+        juce::int64 seed = 0;
+    };
+
+    /** Level a note at nominalVelocity is mixed at, before the groove. */
+    constexpr float hitGain = 0.7f;
+
+    /**
+     * Velocity the built-in loops are written at (MIDI 64). Notes at this velocity
+     * play at hitGain, the level every hit had before velocity was taken into account.
+     */
+    constexpr float nominalVelocity = 64.0f / 127.0f;
+
+    /** Level a note of the given velocity (0-1) is mixed at, before the groove. */
+    constexpr float velocityToGain(float velocity)
+    {
+        return hitGain * (velocity / nominalVelocity);
+    }
+
+    /** Every hit fades out over its last 5 ms, so it never clicks off. */
+    constexpr double hitFadeSeconds = 0.005;
+
+    /**
+     * One sample hit of a pattern, placed at a tempo and sample rate with swing
+     * and the groove already applied.
+     */
+    struct Hit
+    {
+        int startSample = 0;     // from the start of the loop
+        int lengthInSamples = 0; // including the fade-out
+        float gain = 0.0f;
+        SampleLoopGenerator::RepitchedSample sample;
+    };
+
+    /**
+     * A pattern laid out as sample hits, ready to be mixed a block at a time. The
+     * groove's random offsets are drawn once, when the list is made, so a render
+     * sounds the same whatever size of blocks it's mixed in.
+     */
+    struct HitList
+    {
+        std::vector<Hit> hits; // in order of startSample
+        int maxLength = 0;     // no hit is longer than this
+        int fadeSamples = 0;   // shorter hits fade over their whole length
+    };
+
+    /**
+     * Lays out one sample hit per note of a pattern. Each hit lasts at most one
+     * step and is mixed at velocityToGain of the note's velocity.
+     *
+     * @param pattern     The notes to render, with their step grid and swing.
+     * @param data        Pointer to the binary WAV data for the sample.
+     * @param dataSize    Size of the binary data in bytes.
+     * @param bpm         Tempo in beats per minute.
+     * @param sampleRate  Sample rate of the render in Hz.
+     * @param groove      Timing and velocity humanisation (default = none).
+     * @return            The hits, in order.
+     */
+    HitList prepareHits(
+        const RhythmGenerator::Pattern &pattern,
+        const void *data,
+        size_t dataSize,
+        float bpm,
+        double sampleRate,
+        const Groove &groove = {});
+
+    /**
+     * Mixes the hits that reach into output, which holds the loop from sample
+     * bufferStart on. Use it to layer several patterns (e.g. a drum kit) into one
+     * buffer in a single pass, or to render a loop a block at a time; only the
+     * hits overlapping the buffer are visited.
+     *
+     * @param output      Buffer to mix into (all of its channels are used).
+     * @param bufferStart Sample of the loop that output starts at.
+     * @param hits        The hits from prepareHits.
+     */
+    void addToBuffer(
+        juce::AudioBuffer<float> &output,
+        int bufferStart,
+        const HitList &hits);
+
+    /**
+     * Renders a pattern of any length and resolution into an audio buffer, mixing
+     * one sample hit per note. The pattern's swing and the groove move hits off the
+     * grid as they're mixed; the decoded and repitched samples are cached, so
+     * rendering another groove of the same pattern is only a mix pass.
+     *
+     * @param pattern     The notes to render, with their step grid and swing.
+     * @param data        Pointer to the binary WAV data for the sample.
+     * @param dataSize    Size of the binary data in bytes.
+     * @param bpm         Tempo in beats per minute.
+     * @param numChannels Number of audio channels (default = 2).
+     * @param sampleRate  Sample rate in Hz (default = 44100.0).
+     * @param groove      Timing and velocity humanisation (default = none).
+     * @return            An AudioBuffer<float> containing the rendered audio.
+     */
+    juce::AudioBuffer<float> convert(
+        const RhythmGenerator::Pattern &pattern,
+        const void *data,
+        size_t dataSize,
+        float bpm,
+        int numChannels = 2,
+        double sampleRate = 44100.0,
+        const Groove &groove = {});
+
+    /**
+     * Converts a rhythmic Loop8 structure and sample data into an audio buffer by
+     * rendering each MIDI note with the provided sample.
+     *
+     * @param loop        The RhythmGenerator::Loop8 struct defining the rhythm.
+     * @param data        Pointer to the binary WAV data for the sample.
+     * @param dataSize    Size of the binary data in bytes.
+     * @param bpm         Tempo in beats per minute.
+     * @param numChannels Number of audio channels (default = 2).
+     * @param sampleRate  Sample rate in Hz (default = 44100.0).
+     * @return            An AudioBuffer<float> containing the rendered audio.
+     */
+    juce::AudioBuffer<float> convert(
+        const RhythmGenerator::Loop8 &loop,
+        const void *data,
+        size_t dataSize,
+        float bpm,
+        int numChannels = 2,
+        double sampleRate = 44100.0);
+
+    /**
+     * Converts a rhythmic Loop16 structure and sample data into an audio buffer by
+     * rendering each MIDI note with the provided sample. Handles 16th note resolution.
+     *
+     * @param loop        The RhythmGenerator::Loop16 struct defining the rhythm.
+     * @param data        Pointer to the binary WAV data for the sample.
+     * @param dataSize    Size of the binary data in bytes.
+     * @param bpm         Tempo in beats per minute.
+     * @param numChannels Number of audio channels (default = 2).
+     * @param sampleRate  Sample rate in Hz (default = 44100.0).
+     * @return            An AudioBuffer<float> containing the rendered audio.
+     */
+    juce::AudioBuffer<float> convert(
+        const RhythmGenerator::Loop16 &loop,
+        const void *data,
+        size_t dataSize,
+        float bpm,
+        int numChannels = 2,
+        double sampleRate = 44100.0);
+
+    /**
+     * Renders a pattern of any length and resolution with the provided sample and
+     * encodes it as a WAV file.
+     *
+     * @param pattern     The notes to render, with their step grid and swing.
+     * @param data        Pointer to the binary WAV data for the sample.
+     * @param dataSize    Size of the binary data in bytes.
+     * @param bpm         Tempo in beats per minute.
+     * @param numChannels Number of audio channels (default = 2).
+     * @param sampleRate  Sample rate in Hz (default = 44100.0).
+     * @param groove      Timing and velocity humanisation (default = none).
+     * @return            A MemoryBlock containing the WAV file data.
+     */
+    juce::MemoryBlock convertToWavFile(
+        const RhythmGenerator::Pattern &pattern,
+        const void *data,
+        size_t dataSize,
+        float bpm,
+        int numChannels = 2,
+        double sampleRate = 44100.0,
+        const Groove &groove = {});
+
+    /**
+     * Converts a rhythmic Loop8 structure and sample data into an audio buffer by
+     * rendering each MIDI note with the provided sample.
+     *
+     * @param loop        The RhythmGenerator::Loop8 struct defining the rhythm.
+     * @param data        Pointer to the binary WAV data for the sample.
+     * @param dataSize    Size of the binary data in bytes.
+     * @param bpm         Tempo in beats per minute.
+     * @param numChannels Number of audio channels (default = 2).
+     * @param sampleRate  Sample rate in Hz (default = 44100.0).
+     * @return            A MemoryBlock containing the WAV file data.
+     */
+    juce::MemoryBlock convertToWavFile(
+        const RhythmGenerator::Loop8 &loop,
+        const void *data,
+        size_t dataSize,
+        float bpm,
+        int numChannels = 2,
+        double sampleRate = 44100.0);
+
+    /**
+     * Converts a rhythmic Loop16 structure and sample data into an audio buffer by
+     * rendering each MIDI note with the provided sample. Handles 16th note resolution.
+     *
+     * @param loop        The RhythmGenerator::Loop16 struct defining the rhythm.
+     * @param data        Pointer to the binary WAV data for the sample.
+     * @param dataSize    Size of the binary data in bytes.
+     * @param bpm         Tempo in beats per minute.
+     * @param numChannels Number of audio channels (default = 2).
+     * @param sampleRate  Sample rate in Hz (default = 44100.0).
+     * @return            A MemoryBlock containing the WAV file data.
+     */
+    juce::MemoryBlock convertToWavFile(
+        const RhythmGenerator::Loop16 &loop,
+        const void *data,
+        size_t dataSize,
+        float bpm,
+        int numChannels = 2,
+        double sampleRate = 44100.0);
+
+    /**
+     * Renders a pattern with the provided sample and writes it to a WAV stream a
+     * block at a time, so a long render never sits in memory as a whole. The audio
+     * is the same as convert's.
+     *
+     * @param stream        Where to write the WAV file, e.g. a FileOutputStream.
+     * @param pattern       The notes to render, with their step grid and swing.
+     * @param data          Pointer to the binary WAV data for the sample.
+     * @param dataSize      Size of the binary data in bytes.
+     * @param bpm           Tempo in beats per minute.
+     * @param numChannels   Number of audio channels.
+     * @param sampleRate    Sample rate in Hz.
+     * @param bitsPerSample 16 or 24 for integer samples, 32 for floating point.
+     * @param groove        Timing and velocity humanisation (default = none).
+     * @return              true if the whole file was written.
+     */
+    bool writeWavFile(
+        std::unique_ptr<juce::OutputStream> stream,
+        const RhythmGenerator::Pattern &pattern,
+        const void *data,
+        size_t dataSize,
+        float bpm,
+        int numChannels,
+        double sampleRate,
+        int bitsPerSample,
+        const Groove &groove = {});
+
+} // namespace MidiToAudio
\ No newline at end of file
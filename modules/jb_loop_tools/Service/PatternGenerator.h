@@ -0,0 +1,129 @@
+#pragma once
+#include "RhythmGenerator.h"
+
+namespace RhythmGenerator
+{
+    /**
+     * @brief Knobs for generatePattern. All amounts run from 0 to 1.
+     */
+    struct GeneratorSettings
+    {
+        int numBars = 4;
+        int beatsPerBar = 4;
+        int stepsPerBeat = 4;
+        int midiNote = 48;          // C3, the pitch the samples are recorded at
+        float density = 0.5f;       // how busy the pattern is
+        float syncopation = 0.2f;   // 0 favours the strong steps, 1 the weak ones
+        float swing = 0.0f;         // copied into Pattern::swing
+        float variation = 0.25f;    // chance a step differs from the same step of the first bar
+        float sustain = 0.0f;       // chance an empty step holds the note before it
+        int fillEveryBars = 4;      // 0 for no fills
+        float fillAmount = 0.5f;    // extra hits and a crescendo over the last beat of a fill bar
+    };
+
+    /**
+     * @brief How strong a step is in the bar: 1 for the downbeat, 0.75 for the
+     * other beats, 0.5 for the half-beat and 0.25 for everything else.
+     */
+    inline float getMetricWeight(int stepInBar, int stepsPerBeat)
+    {
+        if (stepInBar == 0)
+            return 1.0f;
+        if (stepInBar % stepsPerBeat == 0)
+            return 0.75f;
+        if (stepsPerBeat % 2 == 0 && stepInBar % (stepsPerBeat / 2) == 0)
+            return 0.5f;
+        return 0.25f;
+    }
+
+    /**
+     * @brief Generates a pattern from settings and a seed. The same settings and seed
+     * always give the same pattern, on every platform.
+     *
+     * Each bar replays the first bar's random draws, so the bars share a groove,
+     * and a second stream re-rolls a `variation` share of the steps. Nothing is
+     * allocated once pattern.notes has grown to size, so reusing one Pattern
+     * generates thousands of variations a second.
+     *
+     * @param settings The shape of the pattern.
+     * @param seed Picks the variation.
+     * @param pattern Receives the result; its notes vector is cleared and reused.
+     */
+    inline void generatePattern(const GeneratorSettings &settings, juce::int64 seed, Pattern &pattern)
+    {
+        pattern.numBars = juce::jmax(1, settings.numBars);
+        pattern.beatsPerBar = juce::jmax(1, settings.beatsPerBar);
+        pattern.stepsPerBeat = juce::jmax(1, settings.stepsPerBeat);
+        pattern.swing = juce::jlimit(0.0f, 1.0f, settings.swing);
+        pattern.notes.clear();
+        pattern.notes.reserve((size_t)pattern.getNumSteps());
+
+        const int stepsPerBar = pattern.beatsPerBar * pattern.stepsPerBeat;
+        const int midiNote = juce::jlimit(0, 127, settings.midiNote);
+        const float density = juce::jlimit(0.0f, 1.0f, settings.density);
+        const float syncopation = juce::jlimit(0.0f, 1.0f, settings.syncopation);
+
+        juce::Random varied(seed ^ 0x5bd1e995);
+        bool noteOpen = false;
+
+        for (int bar = 0; bar < pattern.numBars; ++bar)
+        {
+            // Every bar draws the same numbers from here, which is what makes them repeat
+            juce::Random motif(seed);
+            const bool isFillBar = settings.fillEveryBars > 0 && (bar + 1) % settings.fillEveryBars == 0;
+
+            for (int i = 0; i < stepsPerBar; ++i)
+            {
+                float hitRoll = motif.nextFloat();
+                float velocityRoll = motif.nextFloat();
+                float holdRoll = motif.nextFloat();
+
+                if (varied.nextFloat() < settings.variation)
+                {
+                    hitRoll = varied.nextFloat();
+                    velocityRoll = varied.nextFloat();
+                    holdRoll = varied.nextFloat();
+                }
+
+                // Syncopation blends the metric weight towards its opposite
+                const float weight = getMetricWeight(i, pattern.stepsPerBeat);
+                float chance = 2.0f * density * (weight + syncopation * (1.0f - 2.0f * weight));
+                float velocity = 0.5f + 0.4f * weight + 0.1f * (velocityRoll - 0.5f);
+
+                const int stepInFill = i - (stepsPerBar - pattern.stepsPerBeat);
+                if (isFillBar && stepInFill >= 0)
+                {
+                    chance += settings.fillAmount;
+                    velocity += 0.3f * settings.fillAmount * (float)stepInFill / (float)pattern.stepsPerBeat;
+                }
+
+                const int step = bar * stepsPerBar + i;
+
+                if (hitRoll < chance)
+                {
+                    pattern.notes.push_back({step, 1, midiNote, juce::jlimit(0.1f, 1.0f, velocity)});
+                    noteOpen = true;
+                }
+                else if (noteOpen && holdRoll < settings.sustain)
+                {
+                    ++pattern.notes.back().lengthSteps;
+                }
+                else
+                {
+                    noteOpen = false;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Generates a pattern from settings and a seed.
+     * @see generatePattern(const GeneratorSettings &, juce::int64, Pattern &)
+     */
+    inline Pattern generatePattern(const GeneratorSettings &settings, juce::int64 seed)
+    {
+        Pattern pattern;
+        generatePattern(settings, seed, pattern);
+        return pattern;
+    }
+}
@@ -0,0 +1,431 @@
+#pragma once
+#include "MidiNoteHandler.h"
+
+namespace RhythmGenerator
+{
+    typedef enum
+    {
+        Rest = 0,
+        Note = 1,
+        Continuation = 2,
+    } NoteType;
+
+    typedef struct
+    {
+        NoteType noteType;
+        float velocity;
+        MidiNoteHandler::NoteName frequency;
+    } MusicNote;
+
+    // 8 notes per bar
+    typedef struct
+    {
+        MusicNote notes[8];
+    } Bar8;
+
+    // 16 notes per bar
+    typedef struct
+    {
+        MusicNote notes[16];
+    } Bar16;
+
+    typedef struct
+    {
+        Bar8 bar_1;
+        Bar8 bar_2;
+        Bar8 bar_3;
+        Bar8 bar_4;
+    } Loop8;
+
+    typedef struct
+    {
+        Bar16 bar_1;
+        Bar16 bar_2;
+        Bar16 bar_3;
+        Bar16 bar_4;
+    } Loop16;
+
+    /*
+        Example using Twinkle Twinkle Little Star
+        {
+            bar_1: {
+                note_1: { type: Note, velocity: 0.5, frequency: C3 },
+                note_2: { type: Note, velocity: 0.5, frequency: C3 },
+                note_3: { type: Note, velocity: 0.0, frequency: C3 },
+                note_4: { type: Note, velocity: 0.5, frequency: C3 },
+                note_5: { type: Note, velocity: 0.5, frequency: C3 }, // quarter note
+                note_6: { type: Continuation, velocity: 0.5, frequency: C3 },
+                note_7: { type: Note, velocity: 0.5, frequency: C3 }, // quarter note
+                note_8: { type: Continuation, velocity: 0.5, frequency: C3 }
+            },
+            bar_2: {
+                note_1: { type: Note, velocity: 0.5, frequency: G3 },
+                note_2: { type: Note, velocity: 0.5, frequency: G3 },
+                note_3: { type: Note, velocity: 0.5, frequency: G3 },
+                note_4: { type: Note, velocity: 0.5, frequency: G3 },
+                note_5: { type: Rest, velocity: 0.5, frequency: G3 }, // quarter note
+                note_6: { type: Continuation, velocity: 0.5, frequency: G3 },
+                note_7: { type: Note, velocity: 0.5, frequency: G3 }, // quarter note
+                note_8: { type: Continuation, velocity: 0.5, frequency: G3 }
+            },
+            bar_3: {
+                note_1: { type: Note, velocity: 0.5, frequency: A3 },
+                note_2: { type: Note, velocity: 0.5, frequency: A3 },
+                note_3: { type: Note, velocity: 0.5, frequency: A3 },
+                note_4: { type: Note, velocity: 0.5, frequency: A3 },
+                note_5: { type: Rest, velocity: 0.5, frequency: A3 }, // quarter note
+                note_6: { type: Continuation, velocity: 0.5, frequency: A3 },
+                note_7: { type: Note, velocity: 0.5, frequency: A3 }, // quarter note
+                note_8: { type: Continuation, velocity: 0.5, frequency: A3 }
+            },
+            bar_4: {
+                note_1: { type: Note, velocity: 0.5, frequency: G3 },
+                note_2: { type: Note, velocity: 0.5, frequency: G3 },
+                note_3: { type: Note, velocity: 0.5, frequency: G3 },
+                note_4: { type: Note, velocity: 0.5, frequency: G3 },
+                note_5: { type: Rest, velocity: 0.5, frequency: G3 }, // quarter note
+                note_6: { type: Continuation, velocity: 0.5, frequency: G3 },
+                note_7: { type: Note, velocity: 0.5, frequency: G3 }, // quarter note
+                note_8: { type: Continuation, velocity: 0.5, frequency: G3 }
+            },
+            bar_5: {
+                note_1: { type: Note, velocity: 0.5, frequency: F3 },
+                note_2: { type: Note, velocity: 0.5, frequency: F3 },
+                note_3: { type: Note, velocity: 0.5, frequency: F3 },
+                note_4: { type: Note, velocity: 0.5, frequency: F3 },
+                note_5: { type: Rest, velocity: 0.5, frequency: F3 }, // quarter note
+                note_6: { type: Continuation, velocity: 0.5, frequency: F3 },
+                note_7: { type: Note, velocity: 0.5, frequency: F3 }, // quarter note
+                note_8: { type: Continuation, velocity: 0.5, frequency: F3 }
+            },
+            bar_6: {
+                note_1: { type: Note, velocity: 0.5, frequency: E3 },
+                note_2: { type: Note, velocity: 0.5, frequency: E3 },
+                note_3: { type: Note, velocity: 0.5, frequency: E3 },
+                note_4: { type: Note, velocity: 0.5, frequency: E3 },
+                note_5: { type: Rest, velocity: 0.5, frequency: E3 }, // quarter note
+                note_6: { type: Continuation, velocity: 0.5, frequency: E3 },
+                note_7: { type: Note, velocity: 0.5, frequency: E3 }, // quarter note
+                note_8: { type: Continuation, velocity: 0.5, frequency: E3 }
+            },
+            bar_7: {
+                note_1: { type: Note, velocity: 0.5, frequency: D3 },
+                note_2: { type: Note, velocity: 0.5, frequency: D3 },
+                note_3: { type: Note, velocity: 0.5, frequency: D3 },
+                note_4: { type: Note, velocity: 0.5, frequency: D3 },
+                note_5: { type: Rest, velocity: 0.5, frequency: D3 }, // quarter note
+                note_6: { type: Continuation, velocity: 0.5, frequency: D3 },
+                note_7: { type: Note, velocity: 0.5, frequency: D3 }, // quarter note
+                note_8: { type: Continuation, velocity: 0.5, frequency: D3 }
+            },
+            bar_8: {
+                note_1: { type: Note, velocity: 0.5, frequency: C3 },
+                note_2: { type: Note, velocity: 0.5, frequency: C3 },
+                note_3: { type: Note, velocity: 0.5, frequency: C3 },
+                note_4: { type: Note, velocity: 0.5, frequency: C3 },
+                note_5: { type: Rest, velocity: 0.5, frequency: C3 }, // quarter note
+                note_6: { type: Continuation, velocity: 0.5, frequency: C3 },
+                note_7: { type: Note, velocity: 0.5, frequency: C3 }, // quarter note
+                note_8: { type: Continuation, velocity: 0.5, frequency: C3 }
+            },
+        }
+    */
+
+    /**
+     * @brief A note on the step grid, as read straight from a loop.
+     * startStep and lengthSteps count steps (8ths for Loop8, 16ths for Loop16)
+     * from the start of the loop; continuations are folded into lengthSteps.
+     */
+    struct NoteEvent
+    {
+        int startStep;
+        int lengthSteps;
+        int midiNote;
+        float velocity;
+    };
+
+    template <typename Bar, int StepsPerBar, size_t NumBars>
+    inline void collectNoteEvents(const Bar *const (&bars)[NumBars], std::vector<NoteEvent> &events)
+    {
+        events.clear();
+        events.reserve(NumBars * StepsPerBar);
+
+        int step = 0;
+        bool noteOpen = false;
+
+        for (const Bar *bar : bars)
+        {
+            for (int i = 0; i < StepsPerBar; ++i, ++step)
+            {
+                const MusicNote &note = bar->notes[i];
+
+                if (note.noteType == Continuation)
+                {
+                    if (noteOpen)
+                        ++events.back().lengthSteps;
+                    continue;
+                }
+
+                noteOpen = false;
+                if (note.noteType != Note)
+                    continue;
+
+                // Velocities that round to 0 would be a MIDI note-off, so they don't sound
+                const float v = juce::jlimit(0.0f, 1.0f, note.velocity);
+                const int midiNote = MidiNoteHandler::noteToMidiNote(note.frequency);
+                if (midiNote < 0 || juce::MidiMessage::floatValueToMidiByte(v) == 0)
+                    continue;
+
+                events.push_back({step, 1, midiNote, v});
+                noteOpen = true;
+            }
+        }
+    }
+
+    /**
+     * @brief Walks the step grid of a Loop8 and fills events with its notes in order,
+     * without building a MIDI sequence. The vector is cleared and reused.
+     * @param loop The Loop8 structure to read.
+     * @param events Receives one NoteEvent per sounding note.
+     */
+    inline void collectNoteEvents(const Loop8 &loop, std::vector<NoteEvent> &events)
+    {
+        const Bar8 *const bars[4] = {&loop.bar_1, &loop.bar_2, &loop.bar_3, &loop.bar_4};
+        collectNoteEvents<Bar8, 8>(bars, events);
+    }
+
+    /**
+     * @brief Walks the step grid of a Loop16 and fills events with its notes in order,
+     * without building a MIDI sequence. The vector is cleared and reused.
+     * @param loop The Loop16 structure to read.
+     * @param events Receives one NoteEvent per sounding note.
+     */
+    inline void collectNoteEvents(const Loop16 &loop, std::vector<NoteEvent> &events)
+    {
+        const Bar16 *const bars[4] = {&loop.bar_1, &loop.bar_2, &loop.bar_3, &loop.bar_4};
+        collectNoteEvents<Bar16, 16>(bars, events);
+    }
+
+    /**
+     * @brief A loop of any length, meter and resolution: its notes on a step grid.
+     *
+     * stepsPerBeat sets the resolution (2 = 8ths, 3 = 8th triplets, 4 = 16ths,
+     * 6 = 16th triplets, 8 = 32nds) and beatsPerBar the meter (e.g. 7 for 7/4).
+     * Everything that renders loops (MIDI files, audio, live playback) goes
+     * through this one type; the fixed Loop8/Loop16 structs convert to it.
+     *
+     * swing (0 = straight, 1 = full triplet feel) delays every second step of
+     * each pair; it only applies when a beat splits into pairs of steps.
+     */
+    struct Pattern
+    {
+        int numBars = 4;
+        int beatsPerBar = 4;
+        int stepsPerBeat = 4;
+        float swing = 0.0f;
+        std::vector<NoteEvent> notes; // in order of startStep
+
+        int getNumBeats() const { return numBars * beatsPerBar; }
+        int getNumSteps() const { return getNumBeats() * stepsPerBeat; }
+
+        /** Where step actually falls, in steps from the start of the loop, once swing is applied. */
+        double getStepPosition(int step) const
+        {
+            if (swing <= 0.0f || stepsPerBeat % 2 != 0 || step % 2 == 0)
+                return step;
+            // At full swing the off step moves a third of a step later: 2/3 of the way through the pair
+            return step + juce::jlimit(0.0f, 1.0f, swing) / 3.0;
+        }
+    };
+
+    /**
+     * @brief Converts a Loop8 (4 bars of 8th notes) to a Pattern.
+     */
+    inline Pattern toPattern(const Loop8 &loop)
+    {
+        Pattern pattern;
+        pattern.stepsPerBeat = 2;
+        collectNoteEvents(loop, pattern.notes);
+        return pattern;
+    }
+
+    /**
+     * @brief Converts a Loop16 (4 bars of 16th notes) to a Pattern.
+     */
+    inline Pattern toPattern(const Loop16 &loop)
+    {
+        Pattern pattern;
+        pattern.stepsPerBeat = 4;
+        collectNoteEvents(loop, pattern.notes);
+        return pattern;
+    }
+
+    /**
+     * @brief Writes a pattern's notes as one MIDI track, at 960 ticks per quarter note.
+     * Continuations hold the note they follow, odd meters get a time signature and
+     * swung steps are written off the grid.
+     * @param pattern The notes to write.
+     * @param channel MIDI channel (1-16) for the notes.
+     * @return The note-on/note-off pairs, matched.
+     */
+    inline juce::MidiMessageSequence createMidiTrack(
+        const Pattern &pattern,
+        int channel = 1)
+    {
+        juce::MidiMessageSequence sequence;
+        int ticksPerQuarterNote = 960; // Standard MIDI ticks per quarter note
+        double ticksPerStep = static_cast<double>(ticksPerQuarterNote) / pattern.stepsPerBeat;
+
+        if (pattern.beatsPerBar != 4)
+            sequence.addEvent(juce::MidiMessage::timeSignatureMetaEvent(pattern.beatsPerBar, 4));
+
+        for (const auto &note : pattern.notes)
+        {
+            double onTime = pattern.getStepPosition(note.startStep) * ticksPerStep;
+
+            // Each note-off goes in before the next note starts on the same tick
+            auto noteOn = juce::MidiMessage::noteOn(channel, note.midiNote, note.velocity);
+            noteOn.setTimeStamp(onTime);
+            sequence.addEvent(noteOn);
+
+            auto noteOff = juce::MidiMessage::noteOff(channel, note.midiNote);
+            noteOff.setTimeStamp(pattern.getStepPosition(note.startStep + note.lengthSteps) * ticksPerStep);
+            sequence.addEvent(noteOff);
+        }
+
+        // Update matched pairs (JUCE's way of associating note-ons with their note-offs)
+        sequence.updateMatchedPairs();
+        return sequence;
+    }
+
+    /**
+     * @brief Generates a MIDI file with one track per pattern, e.g. the layers of a
+     * drum kit, so each layer can go to its own instrument. Every layer gets its own
+     * channel, and the first track carries the tempo.
+     * @param layers The patterns to write, one per track.
+     * @param bpm Beats per minute for the MIDI sequence.
+     * @return A MemoryBlock containing the generated MIDI file.
+     */
+    inline juce::MemoryBlock createMIDISequence(
+        const std::vector<Pattern> &layers,
+        float bpm)
+    {
+        // Create the MIDI file
+        juce::MidiFile midiFile;
+        midiFile.setTicksPerQuarterNote(960);
+
+        const auto tempo = juce::MidiMessage::tempoMetaEvent(juce::roundToInt(60000000.0 / bpm));
+
+        for (size_t i = 0; i < layers.size(); ++i)
+        {
+            juce::MidiMessageSequence track;
+
+            // Track 0 starts with the tempo, where DAWs look for it
+            if (i == 0)
+                track.addEvent(tempo);
+
+            track.addSequence(createMidiTrack(layers[i], 1 + (int)(i % 16)), 0.0);
+            track.updateMatchedPairs();
+            midiFile.addTrack(track);
+        }
+
+        if (layers.empty())
+        {
+            juce::MidiMessageSequence track;
+            track.addEvent(tempo);
+            midiFile.addTrack(track);
+        }
+
+        // Write to memory block
+        juce::MemoryBlock block;
+        juce::MemoryOutputStream stream(block, false);
+        midiFile.writeTo(stream);
+
+        return block;
+    }
+
+    /**
+     * @brief Generates a MIDI sequence from a pattern of any length and resolution.
+     * @param pattern The notes to write.
+     * @param bpm Beats per minute for the MIDI sequence.
+     * @return A MemoryBlock containing the generated MIDI sequence.
+     */
+    inline juce::MemoryBlock createMIDISequence(
+        const Pattern &pattern,
+        float bpm)
+    {
+        return createMIDISequence(std::vector<Pattern>{pattern}, bpm);
+    }
+
+    /**
+     * @brief Generates a MIDI sequence from the first numNotes 8th notes of a bar.
+     * @param bar struct containing notes
+     * @param bpm Beats per minute for the MIDI sequence.
+     * @return A MemoryBlock containing the generated MIDI sequence.
+     */
+    inline juce::MemoryBlock createMIDISequence(
+        const Bar8 bar,
+        int numNotes,
+        float bpm)
+    {
+        Bar8 firstNotes = bar;
+        for (int i = juce::jlimit(0, 8, numNotes); i < 8; ++i)
+            firstNotes.notes[i].noteType = Rest;
+
+        const Bar8 *const bars[1] = {&firstNotes};
+        Pattern pattern;
+        pattern.numBars = 1;
+        pattern.stepsPerBeat = 2;
+        collectNoteEvents<Bar8, 8>(bars, pattern.notes);
+        return createMIDISequence(pattern, bpm);
+    }
+
+    /**
+     * @brief Generates a MIDI sequence from the first numNotes 16th notes of a bar.
+     * @param bar struct containing notes
+     * @param bpm Beats per minute for the MIDI sequence.
+     * @return A MemoryBlock containing the generated MIDI sequence.
+     */
+    inline juce::MemoryBlock createMIDISequence(
+        const Bar16 bar,
+        int numNotes,
+        float bpm)
+    {
+        Bar16 firstNotes = bar;
+        for (int i = juce::jlimit(0, 16, numNotes); i < 16; ++i)
+            firstNotes.notes[i].noteType = Rest;
+
+        const Bar16 *const bars[1] = {&firstNotes};
+        Pattern pattern;
+        pattern.numBars = 1;
+        pattern.stepsPerBeat = 4;
+        collectNoteEvents<Bar16, 16>(bars, pattern.notes);
+        return createMIDISequence(pattern, bpm);
+    }
+
+    /**
+     * @brief Generates a MIDI sequence based on a Loop8 rhythm structure.
+     * @param loop The Loop8 structure containing multiple bars of notes.
+     * @param bpm Beats per minute for the MIDI sequence.
+     * @return A MemoryBlock containing the generated MIDI sequence.
+     */
+    inline juce::MemoryBlock createMIDISequence(
+        const Loop8 loop,
+        float bpm)
+    {
+        return createMIDISequence(toPattern(loop), bpm);
+    }
+
+    /**
+     * @brief Generates a MIDI sequence based on a Loop16 rhythm structure.
+     * @param loop The Loop16 structure containing multiple bars of notes.
+     * @param bpm Beats per minute for the MIDI sequence.
+     * @return A MemoryBlock containing the generated MIDI sequence.
+     */
+    inline juce::MemoryBlock createMIDISequence(
+        const Loop16 loop,
+        float bpm)
+    {
+        return createMIDISequence(toPattern(loop), bpm);
+    }
+}
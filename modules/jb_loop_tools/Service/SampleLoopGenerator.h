@@ -0,0 +1,335 @@
+#pragma once
+#include <map>
+#include <memory>
+#include <utility>
+
+namespace SampleLoopGenerator
+{
+    /**
+     * Decodes WAV data from any InputStream into a buffer.
+     *
+     * @param inStream  Pointer to an open InputStream containing WAV data.
+     *                  The reader will delete this stream when done.
+     * @return          The decoded sample, or an empty buffer if it can't be read.
+     */
+    inline juce::AudioBuffer<float> decodeFromStream(juce::InputStream *inStream)
+    {
+        std::unique_ptr<juce::AudioFormatReader> reader(
+            juce::WavAudioFormat().createReaderFor(inStream, /*deleteWhenDone*/ true));
+        jassert(reader != nullptr);
+
+        juce::AudioBuffer<float> sampleBuf;
+        if (reader == nullptr)
+            return sampleBuf;
+
+        // Decode the entire sample into a buffer
+        sampleBuf.setSize((int)reader->numChannels, (int)reader->lengthInSamples);
+        reader->read(&sampleBuf,
+                     0,
+                     sampleBuf.getNumSamples(),
+                     0,
+                     true,
+                     true);
+
+        return sampleBuf;
+    }
+
+    using DecodedSample = std::shared_ptr<const juce::AudioBuffer<float>>;
+
+    /**
+     * Returns the decoded form of embedded WAV data, decoding it only the first time.
+     * Entries are keyed by the data pointer, so this is meant for data that lives for
+     * the whole program (e.g. BinaryData). Safe to call from any thread.
+     *
+     * @param data      Pointer to the binary data.
+     * @param dataSize  Size of the binary data in bytes.
+     */
+    inline DecodedSample getDecodedSample(const void *data, size_t dataSize)
+    {
+        static juce::CriticalSection cacheLock;
+        static std::map<const void *, DecodedSample> cache;
+
+        const juce::ScopedLock sl(cacheLock);
+        auto &entry = cache[data];
+        if (entry == nullptr)
+            entry = std::make_shared<const juce::AudioBuffer<float>>(
+                decodeFromStream(new juce::MemoryInputStream(data, dataSize, false)));
+
+        return entry;
+    }
+
+    /**
+     * Core generator: tiles an already decoded sample at each beat with optional
+     * pitch-shift.
+     *
+     * @param sampleBuf         The decoded sample.
+     * @param frequency         Target pitch in Hz (e.g. from your frequency slider).
+     * @param lengthInSamples   Total loop length in samples.
+     * @param sampleRate        DAW sample rate (Hz).
+     * @param bpm               Tempo (beats per minute).
+     * @param numChannels       Number of output channels.
+     * @param originalFreq      Frequency of the original sample (default C3 = 130.81278 Hz).
+     * @param gain              Multiplier applied to each sample hit (default 0.7f).
+     */
+    inline juce::AudioBuffer<float> generateSampleLoop(
+        const juce::AudioBuffer<float> &sampleBuf,
+        float frequency,
+        int lengthInSamples,
+        double sampleRate,
+        float bpm,
+        int numChannels,
+        float originalFreq = 130.81278f,
+        float gain = 0.7f)
+    {
+        // Calculate samples per beat and pitch ratio
+        int samplesPerBeat = int(sampleRate * (60.0 / bpm));
+        float pitchRatio = originalFreq / frequency;
+
+        // Prepare output and tile sample
+        juce::AudioBuffer<float> out(numChannels, lengthInSamples);
+        out.clear();
+
+        if (sampleBuf.getNumChannels() == 0)
+            return out;
+
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            auto *dest = out.getWritePointer(ch);
+            auto *src = sampleBuf.getReadPointer(juce::jmin(ch, sampleBuf.getNumChannels() - 1));
+            int srcLen = sampleBuf.getNumSamples();
+
+            for (int start = 0; start < lengthInSamples; start += samplesPerBeat)
+            {
+                for (int i = 0; i < srcLen && start + i < lengthInSamples; ++i)
+                {
+                    double idx = i / pitchRatio;
+                    if (idx >= srcLen - 1)
+                        break;
+
+                    int i0 = (int)idx;
+                    float frac = (float)(idx - i0);
+                    float v = src[i0] * (1.0f - frac) + src[i0 + 1] * frac;
+
+                    dest[start + i] += v * gain;
+                }
+            }
+        }
+
+        return out;
+    }
+
+    using RepitchedSample = std::shared_ptr<const juce::AudioBuffer<float>>;
+
+    /**
+     * Returns the sample repitched to frequency (at unity gain), computing it only the
+     * first time a given (sample, pitch) pair is asked for. Loops repeat the same few
+     * notes, so most hits become a plain mix from here. The result stops where the
+     * sample runs out, with the same limits as generateSampleLoop, and doesn't depend
+     * on tempo or sample rate: callers cut each hit to length as they mix it.
+     * The most recently used results are kept. Safe to call from any thread.
+     *
+     * @param sample            The decoded sample, e.g. from getDecodedSample.
+     * @param frequency         Target pitch in Hz.
+     * @param originalFreq      Frequency of the original sample (default C3 = 130.81278 Hz).
+     */
+    inline RepitchedSample getRepitchedSample(
+        const DecodedSample &sample,
+        float frequency,
+        float originalFreq = 130.81278f)
+    {
+        struct Entry
+        {
+            DecodedSample source; // keeps the key's buffer pointer valid
+            RepitchedSample repitched;
+            juce::uint64 lastUsed = 0;
+        };
+
+        using Key = std::pair<const juce::AudioBuffer<float> *, float>;
+
+        // A whole sample per entry, so keep a bounded number of them
+        constexpr size_t maxEntries = 128;
+
+        static juce::CriticalSection cacheLock;
+        static std::map<Key, Entry> cache;
+        static juce::uint64 useCounter = 0;
+
+        const float pitchRatio = originalFreq / frequency;
+        const Key key{sample.get(), pitchRatio};
+
+        {
+            const juce::ScopedLock sl(cacheLock);
+            if (auto it = cache.find(key); it != cache.end())
+            {
+                it->second.lastUsed = ++useCounter;
+                return it->second.repitched;
+            }
+        }
+
+        // Repitch without holding the lock, so other threads' lookups don't wait on it
+        const int srcChannels = sample->getNumChannels();
+        const int srcLen = sample->getNumSamples();
+
+        // Output samples before the read position passes the end of the sample
+        int length = 0;
+        while (length < srcLen && length / pitchRatio < srcLen - 1)
+            ++length;
+
+        auto repitched = std::make_shared<juce::AudioBuffer<float>>(srcChannels, length);
+        for (int ch = 0; ch < srcChannels; ++ch)
+        {
+            const float *src = sample->getReadPointer(ch);
+            float *dest = repitched->getWritePointer(ch);
+            for (int i = 0; i < length; ++i)
+            {
+                double idx = i / pitchRatio;
+                int i0 = (int)idx;
+                float frac = (float)(idx - i0);
+                dest[i] = src[i0] * (1.0f - frac) + src[i0 + 1] * frac;
+            }
+        }
+
+        const juce::ScopedLock sl(cacheLock);
+
+        // Another thread may have got there first; everyone shares its copy
+        if (auto it = cache.find(key); it != cache.end())
+        {
+            it->second.lastUsed = ++useCounter;
+            return it->second.repitched;
+        }
+
+        if (cache.size() >= maxEntries)
+        {
+            auto leastRecent = cache.begin();
+            for (auto it = cache.begin(); it != cache.end(); ++it)
+                if (it->second.lastUsed < leastRecent->second.lastUsed)
+                    leastRecent = it;
+            cache.erase(leastRecent);
+        }
+
+        cache[key] = {sample, repitched, ++useCounter};
+        return repitched;
+    }
+
+    /**
+     * Mixes one hit of a repitched sample into dest, ramping the last fadeSamples of
+     * the hit down to silence. Mono samples go to every channel. Nothing is allocated
+     * and only the part of the hit that lands inside dest is mixed, so a hit can be
+     * rendered a block at a time (destStart is negative once the hit has started).
+     *
+     * @param dest              Buffer to mix into (all of its channels are used).
+     * @param destStart         Sample in dest where the hit starts.
+     * @param lengthInSamples   Length of the hit, including the fade.
+     * @param repitched         Repitched sample from getRepitchedSample.
+     * @param fadeSamples       Length of the fade-out at the end of the hit.
+     * @param gain              Multiplier applied to the hit (default 0.7f).
+     */
+    inline void addRepitchedHit(
+        juce::AudioBuffer<float> &dest,
+        int destStart,
+        int lengthInSamples,
+        const juce::AudioBuffer<float> &repitched,
+        int fadeSamples,
+        float gain = 0.7f)
+    {
+        // The hit's samples from first up to (not including) length land inside dest
+        const int srcChannels = repitched.getNumChannels();
+        const int first = juce::jmax(0, -destStart);
+        const int length = juce::jmin(lengthInSamples,
+                                      repitched.getNumSamples(),
+                                      dest.getNumSamples() - destStart);
+        if (srcChannels == 0 || length <= first)
+            return;
+
+        fadeSamples = juce::jlimit(0, lengthInSamples, fadeSamples);
+        const int fadeStart = lengthInSamples - fadeSamples;
+        const int bodyEnd = juce::jmin(length, fadeStart);
+        const int fadeFrom = juce::jmax(first, fadeStart);
+
+        for (int ch = 0; ch < dest.getNumChannels(); ++ch)
+        {
+            const float *src = repitched.getReadPointer(juce::jmin(ch, srcChannels - 1));
+
+            if (bodyEnd > first)
+                dest.addFrom(ch, destStart + first, src + first, bodyEnd - first, gain);
+
+            if (length > fadeFrom)
+            {
+                // Gain falls by gain / fadeSamples per sample and hits 0 on the last one
+                const float step = gain / (float)fadeSamples;
+                const float startGain = step * (float)(fadeSamples - 1 - (fadeFrom - fadeStart));
+                dest.addFromWithRamp(ch, destStart + fadeFrom, src + fadeFrom, length - fadeFrom,
+                                     startGain, startGain - step * (float)(length - fadeFrom));
+            }
+        }
+    }
+
+    /**
+     * Reads from any InputStream (e.g., MemoryInputStream or FileInputStream)
+     * and tiles the sample at each beat with optional pitch-shift.
+     *
+     * @param inStream          Pointer to an open InputStream containing WAV data.
+     *                          The reader will delete this stream when done.
+     * @param frequency         Target pitch in Hz (e.g. from your frequency slider).
+     * @param lengthInSamples   Total loop length in samples.
+     * @param sampleRate        DAW sample rate (Hz).
+     * @param bpm               Tempo (beats per minute).
+     * @param numChannels       Number of output channels.
+     * @param originalFreq      Frequency of the original sample (default C3 = 130.81278 Hz).
+     * @param gain              Multiplier applied to each sample hit (default 0.7f).
+     */
+    inline juce::AudioBuffer<float> generateSampleLoopFromStream(
+        juce::InputStream *inStream,
+        float frequency,
+        int lengthInSamples,
+        double sampleRate,
+        float bpm,
+        int numChannels,
+        float originalFreq = 130.81278f,
+        float gain = 0.7f)
+    {
+        return generateSampleLoop(decodeFromStream(inStream),
+                                  frequency,
+                                  lengthInSamples,
+                                  sampleRate,
+                                  bpm,
+                                  numChannels,
+                                  originalFreq,
+                                  gain);
+    }
+
+    /**
+     * Convenience function to generate a sample loop from binary data.
+     * The data is decoded once and cached (see getDecodedSample).
+     *
+     * @param data             Pointer to the binary data.
+     * @param dataSize         Size of the binary data in bytes.
+     * @param frequency        Target pitch in Hz (e.g. from your frequency slider).
+     * @param lengthInSamples  Total loop length in samples.
+     * @param sampleRate       DAW sample rate (Hz).
+     * @param bpm              Tempo (beats per minute).
+     * @param numChannels      Number of output channels.
+     * @param originalFreq     Frequency of the original sample (default C3 = 130.81278 Hz).
+     * @param gain             Multiplier applied to each sample hit (default 0.7f).
+     */
+    inline juce::AudioBuffer<float> generateSampleLoopFromBinary(
+        const void *data,
+        size_t dataSize,
+        float frequency,
+        int lengthInSamples,
+        double sampleRate,
+        float bpm,
+        int numChannels,
+        float originalFreq = 130.81278f,
+        float gain = 0.7f)
+    {
+        return generateSampleLoop(
+            *getDecodedSample(data, dataSize),
+            frequency,
+            lengthInSamples,
+            sampleRate,
+            bpm,
+            numChannels,
+            originalFreq,
+            gain);
+    }
+}
@@ -0,0 +1,101 @@
+#pragma once
+#include <functional>
+#include <memory>
+
+/**
+ * Namespace holding the WAV encoding shared by every loop generator, both in
+ * memory (for drag-and-drop) and streamed to disk (for long renders).
+ */
+namespace WavWriter
+{
+    /** Block size used when streaming a render to a WAV file. */
+    constexpr int streamBlockSize = 4096;
+
+    /** Mixes the audio from sample blockStart on into block, which arrives cleared. */
+    using BlockRenderer = std::function<void(juce::AudioBuffer<float> &block, int blockStart)>;
+
+    /**
+     * Creates a WAV file from an audio buffer.
+     *
+     * @param buffer         The audio buffer to write to the WAV file.
+     * @param sampleRate     The sample rate of the audio buffer.
+     * @param bitsPerSample  16 or 24 for integer samples, 32 for floating point (default 16).
+     * @return               A MemoryBlock containing the WAV file data.
+     */
+    inline juce::MemoryBlock createWavFile(
+        const juce::AudioBuffer<float> &buffer,
+        double sampleRate,
+        int bitsPerSample = 16)
+    {
+        juce::MemoryBlock result;
+        auto writer = std::unique_ptr<juce::AudioFormatWriter>(
+            juce::WavAudioFormat().createWriterFor(
+                new juce::MemoryOutputStream(result, false),
+                sampleRate,
+                buffer.getNumChannels(),
+                bitsPerSample,
+                {},
+                0));
+
+        if (writer)
+            writer->writeFromAudioSampleBuffer(buffer, 0, buffer.getNumSamples());
+
+        return result;
+    }
+
+    /**
+     * Writes a WAV file to a stream while its audio is rendered, streamBlockSize
+     * samples at a time: peak memory is one block, not the whole file twice.
+     *
+     * @param stream          Where to write the WAV file, e.g. a FileOutputStream.
+     * @param lengthInSamples Total length of the audio in samples.
+     * @param numChannels     Number of audio channels.
+     * @param sampleRate      Sample rate in Hz.
+     * @param bitsPerSample   16 or 24 for integer samples, 32 for floating point.
+     * @param renderBlock     Mixes the audio from sample blockStart on into a cleared block.
+     * @return                true if the whole file was written.
+     */
+    inline bool writeWavFile(
+        std::unique_ptr<juce::OutputStream> stream,
+        int lengthInSamples,
+        int numChannels,
+        double sampleRate,
+        int bitsPerSample,
+        const BlockRenderer &renderBlock)
+    {
+        if (stream == nullptr || numChannels <= 0)
+            return false;
+
+        std::unique_ptr<juce::AudioFormatWriter> writer(
+            juce::WavAudioFormat().createWriterFor(
+                stream.get(),
+                sampleRate,
+                numChannels,
+                bitsPerSample,
+                {},
+                0));
+
+        if (writer == nullptr)
+            return false;
+
+        // The writer deletes the stream from here on
+        stream.release();
+
+        // Only ever one block of float samples, however long the file is
+        juce::AudioBuffer<float> block(numChannels, juce::jmin(streamBlockSize, lengthInSamples));
+
+        for (int blockStart = 0; blockStart < lengthInSamples; blockStart += streamBlockSize)
+        {
+            const int numSamples = juce::jmin(streamBlockSize, lengthInSamples - blockStart);
+            block.setSize(numChannels, numSamples, false, false, true);
+            block.clear();
+
+            renderBlock(block, blockStart);
+
+            if (!writer->writeFromAudioSampleBuffer(block, 0, numSamples))
+                return false;
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,3 @@
+#include "jb_loop_tools.h"
+
+#include "Service/MidiToAudio.cpp"
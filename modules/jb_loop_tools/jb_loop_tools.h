@@ -0,0 +1,39 @@
+/*******************************************************************************
+ The block below describes the properties of this module, and is read by
+ the Projucer to automatically generate project code that uses it.
+
+ BEGIN_JUCE_MODULE_DECLARATION
+
+  ID:                 jb_loop_tools
+  vendor:             JBlanked
+  version:            1.0.0
+  name:               JBlanked loop tools
+  description:        Rhythm patterns, MIDI and audio loop rendering and WAV export shared by the JBlanked plugins.
+  website:            www.jblanked.com
+  minimumCppStandard: 17
+
+  dependencies:       juce_audio_basics juce_audio_formats
+
+ END_JUCE_MODULE_DECLARATION
+*******************************************************************************/
+
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <juce_audio_formats/juce_audio_formats.h>
+
+#include "Service/MidiNoteHandler.h"
+#include "Service/RhythmGenerator.h"
+#include "Service/StepPattern.h"
+#include "Service/PatternGenerator.h"
+#include "Service/SampleLoopGenerator.h"
+#include "Service/WavWriter.h"
+#include "Service/MidiToAudio.h"
+#include "Service/AudioLoopGenerator.h"
+#include "Service/MidiLoopGenerator.h"
+
+// The drag-and-drop component is only there for projects with a GUI
+#if JUCE_MODULE_AVAILABLE_juce_gui_basics
+ #include <juce_gui_basics/juce_gui_basics.h>
+ #include "Service/DraggableLoopComponent.h"
+#endif
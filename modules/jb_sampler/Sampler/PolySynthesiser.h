@@ -0,0 +1,411 @@
+#pragma once
+
+#include "SampleVoice.h"
+#include <array>
+#include <atomic>
+#include <vector>
+
+/**
+    PolySynthesiser: a juce::Synthesiser that owns a fixed pool of SampleVoices
+    (up to 256) and allocates them in constant time.
+
+    Every voice sits on exactly one of three age-ordered lists (free, held, released)
+    and held voices are also linked per MIDI note, so note-on, note-off and voice
+    stealing never scan the whole pool. When the pool is exhausted the oldest
+    released voice is stolen first (it is already fading out and is the quietest),
+    then the oldest held voice.
+
+    Optionally, the sounds are resampled to the playback rate on a background
+    thread whenever the rate changes, so voices only interpolate for pitch.
+*/
+class PolySynthesiser : public juce::Synthesiser
+{
+public:
+    static constexpr int maxPolyphony = 256;
+    static constexpr int maxOutputBuses = 16;
+
+    explicit PolySynthesiser(int numVoices = 8)
+    {
+        setPolyphony(numVoices);
+    }
+
+    ~PolySynthesiser() override
+    {
+        // Resample jobs use the voice pool, so they have to finish first
+        resamplePool.removeAllJobs(true, 5000);
+    }
+
+    /** Replaces the voice pool. Any sounding notes are cut. */
+    void setPolyphony(int numVoices)
+    {
+        numVoices = juce::jlimit(1, maxPolyphony, numVoices);
+
+        const juce::ScopedLock sl(lock);
+        clearVoices();
+
+        links.assign((size_t)numVoices, {});
+        freeList = heldList = releasedList = {};
+        noteHeads.fill(-1);
+
+        for (int i = 0; i < numVoices; ++i)
+        {
+            addVoice(new Voice(*this, i));
+            pushBack(freeList, i);
+        }
+    }
+
+    int getPolyphony() const { return (int)links.size(); }
+
+    void setInterpolation(SampleVoice::Interpolation interpolation)
+    {
+        const juce::ScopedLock sl(lock);
+        for (auto *voice : voices)
+            static_cast<Voice *>(voice)->setInterpolation(interpolation);
+    }
+
+    /**
+        When enabled, every SampleSound is resampled to the playback rate whenever
+        the rate changes or resampleSounds() is called. The work happens on a
+        background thread; until it's done voices play the original data. The new
+        data is swapped in for new notes only: sounding notes finish on the data
+        they started with.
+    */
+    void setResampleToPlaybackRate(bool shouldResample)
+    {
+        resampleToPlaybackRate.store(shouldResample);
+        resampleSounds();
+    }
+
+    void setCurrentPlaybackSampleRate(double newRate) override
+    {
+        juce::Synthesiser::setCurrentPlaybackSampleRate(newRate);
+        playbackRate.store(newRate);
+        resampleSounds();
+    }
+
+    /** Queues resampling of the current sounds. Call after adding sounds. */
+    void resampleSounds()
+    {
+        const double rate = playbackRate.load();
+        if (!resampleToPlaybackRate.load() || rate <= 0.0)
+            return;
+
+        juce::ReferenceCountedArray<SampleSound> pending;
+        {
+            const juce::ScopedLock sl(lock);
+            for (auto *sound : sounds)
+                if (auto *sampleSound = dynamic_cast<SampleSound *>(sound))
+                    if (sampleSound->getSampleRate() != rate)
+                        pending.add(sampleSound);
+        }
+
+        if (!pending.isEmpty())
+            resamplePool.addJob([this, pending, rate]
+                                {
+                                    for (auto *sound : pending)
+                                        resample(*sound, rate);
+                                });
+    }
+
+    /**
+        Sets the buffers for the extra output buses for the next render. Voices whose
+        sound has an output bus > 0 render straight into that buffer instead of the
+        main one; disabled buses (no channels) fall back to the main output.
+        The buffers must stay valid until rendering is done.
+    */
+    void setOutputBuses(juce::AudioBuffer<float> *const *buses, int numBuses) noexcept
+    {
+        numOutputBuses = buses != nullptr ? juce::jmin(numBuses, maxOutputBuses) : 0;
+        for (int i = 0; i < numOutputBuses; ++i)
+            outputBuses[(size_t)i] = buses[i];
+    }
+
+    void noteOn(int midiChannel, int midiNoteNumber, float velocity) override
+    {
+        const juce::ScopedLock sl(lock);
+
+        for (auto *sound : sounds)
+        {
+            if (!sound->appliesToNote(midiNoteNumber) || !sound->appliesToChannel(midiChannel))
+                continue;
+
+            if (auto *sampleSound = dynamic_cast<SampleSound *>(sound))
+                if (sampleSound->getChokeGroup() > 0)
+                    chokeGroup(sampleSound->getChokeGroup());
+
+            // If hitting a note that's still held (key or pedal), stop it first
+            for (int i = noteHeads[(size_t)midiNoteNumber]; i >= 0;)
+            {
+                const int next = links[(size_t)i].noteNext;
+                auto *voice = voices.getUnchecked(i);
+                if (voice->isPlayingChannel(midiChannel))
+                    stopVoice(voice, 1.0f, true);
+                i = next;
+            }
+
+            startVoice(findFreeVoice(sound, midiChannel, midiNoteNumber, isNoteStealingEnabled()),
+                       sound, midiChannel, midiNoteNumber, velocity);
+        }
+    }
+
+    void noteOff(int midiChannel, int midiNoteNumber, float velocity, bool allowTailOff) override
+    {
+        const juce::ScopedLock sl(lock);
+
+        for (int i = noteHeads[(size_t)midiNoteNumber]; i >= 0;)
+        {
+            const int next = links[(size_t)i].noteNext;
+            auto *voice = voices.getUnchecked(i);
+
+            if (voice->isPlayingChannel(midiChannel))
+            {
+                if (auto sound = voice->getCurrentlyPlayingSound())
+                {
+                    if (sound->appliesToNote(midiNoteNumber) && sound->appliesToChannel(midiChannel))
+                    {
+                        voice->setKeyDown(false);
+
+                        if (!(voice->isSustainPedalDown() || voice->isSostenutoPedalDown()))
+                            stopVoice(voice, velocity, allowTailOff);
+                    }
+                }
+            }
+            i = next;
+        }
+    }
+
+protected:
+    juce::SynthesiserVoice *findFreeVoice(juce::SynthesiserSound *soundToPlay,
+                                          int midiChannel,
+                                          int midiNoteNumber,
+                                          bool stealIfNoneAvailable) const override
+    {
+        if (freeList.head >= 0)
+            return voices.getUnchecked(freeList.head);
+
+        if (stealIfNoneAvailable)
+            return findVoiceToSteal(soundToPlay, midiChannel, midiNoteNumber);
+
+        return nullptr;
+    }
+
+    juce::SynthesiserVoice *findVoiceToSteal(juce::SynthesiserSound *,
+                                             int,
+                                             int) const override
+    {
+        if (releasedList.head >= 0)
+            return voices.getUnchecked(releasedList.head);
+
+        if (heldList.head >= 0)
+            return voices.getUnchecked(heldList.head);
+
+        return nullptr;
+    }
+
+private:
+    /** A SampleVoice that reports its start/stop transitions back to the pool. */
+    class Voice : public SampleVoice
+    {
+    public:
+        Voice(PolySynthesiser &owner, int index) : owner(owner), index(index) {}
+
+        using SampleVoice::renderNextBlock;
+
+        void startNote(int midiNoteNumber, float velocity,
+                       juce::SynthesiserSound *sound, int currentPitchWheelPosition) override
+        {
+            SampleVoice::startNote(midiNoteNumber, velocity, sound, currentPitchWheelPosition);
+            if (isVoiceActive())
+                owner.voiceStarted(index, midiNoteNumber);
+        }
+
+        void stopNote(float velocity, bool allowTailOff) override
+        {
+            SampleVoice::stopNote(velocity, allowTailOff);
+            owner.voiceStopped(index, isVoiceActive());
+        }
+
+        void renderNextBlock(juce::AudioBuffer<float> &outputBuffer, int startSample, int numSamples) override
+        {
+            SampleVoice::renderNextBlock(owner.outputFor(*this, outputBuffer), startSample, numSamples);
+            if (!isVoiceActive())
+                owner.voiceStopped(index, false);
+        }
+
+        void choke()
+        {
+            SampleVoice::choke();
+            owner.voiceStopped(index, isVoiceActive());
+        }
+
+    private:
+        PolySynthesiser &owner;
+        const int index;
+    };
+
+    enum class VoiceState
+    {
+        Free,
+        Held,
+        Released
+    };
+
+    struct Link
+    {
+        int prev = -1, next = -1;
+        int notePrev = -1, noteNext = -1;
+        int note = -1;
+        VoiceState state = VoiceState::Free;
+    };
+
+    struct List
+    {
+        int head = -1, tail = -1;
+    };
+
+    List &listFor(VoiceState state)
+    {
+        switch (state)
+        {
+        case VoiceState::Held:
+            return heldList;
+        case VoiceState::Released:
+            return releasedList;
+        default:
+            return freeList;
+        }
+    }
+
+    void pushBack(List &list, int i)
+    {
+        auto &l = links[(size_t)i];
+        l.prev = list.tail;
+        l.next = -1;
+        if (list.tail >= 0)
+            links[(size_t)list.tail].next = i;
+        else
+            list.head = i;
+        list.tail = i;
+    }
+
+    void unlink(List &list, int i)
+    {
+        auto &l = links[(size_t)i];
+        if (l.prev >= 0)
+            links[(size_t)l.prev].next = l.next;
+        else
+            list.head = l.next;
+        if (l.next >= 0)
+            links[(size_t)l.next].prev = l.prev;
+        else
+            list.tail = l.prev;
+        l.prev = l.next = -1;
+    }
+
+    void moveTo(int i, VoiceState state)
+    {
+        auto &l = links[(size_t)i];
+        unlink(listFor(l.state), i);
+        l.state = state;
+        pushBack(listFor(state), i);
+    }
+
+    void linkNote(int i, int note)
+    {
+        auto &l = links[(size_t)i];
+        l.note = note;
+        l.notePrev = -1;
+        l.noteNext = noteHeads[(size_t)note];
+        if (l.noteNext >= 0)
+            links[(size_t)l.noteNext].notePrev = i;
+        noteHeads[(size_t)note] = i;
+    }
+
+    void unlinkNote(int i)
+    {
+        auto &l = links[(size_t)i];
+        if (l.note < 0)
+            return;
+        if (l.notePrev >= 0)
+            links[(size_t)l.notePrev].noteNext = l.noteNext;
+        else
+            noteHeads[(size_t)l.note] = l.noteNext;
+        if (l.noteNext >= 0)
+            links[(size_t)l.noteNext].notePrev = l.notePrev;
+        l.notePrev = l.noteNext = l.note = -1;
+    }
+
+    juce::AudioBuffer<float> &outputFor(const SampleVoice &voice, juce::AudioBuffer<float> &mainOutput) const noexcept
+    {
+        const int bus = voice.getOutputBus();
+        if (bus > 0 && bus <= numOutputBuses)
+            if (auto *busBuffer = outputBuses[(size_t)bus - 1]; busBuffer != nullptr && busBuffer->getNumChannels() > 0)
+                return *busBuffer;
+        return mainOutput;
+    }
+
+    // Runs on the resample thread; the audio thread only waits for the pointer swap
+    void resample(SampleSound &sound, double rate)
+    {
+        // Data replaced by an earlier rate change that no voice plays any more
+        sound.releaseUnusedData();
+
+        // Skip work a newer rate change has made stale
+        if (playbackRate.load() != rate || sound.getSampleRate() == rate)
+            return;
+
+        auto newData = sound.createResampled(rate);
+
+        const juce::ScopedLock sl(lock);
+        if (playbackRate.load() == rate)
+            sound.swapData(std::move(newData));
+    }
+
+    // Only sounding voices are visited, and only when a choking sound is hit
+    void chokeGroup(int group)
+    {
+        for (auto *list : {&heldList, &releasedList})
+        {
+            for (int i = list->head; i >= 0;)
+            {
+                const int next = links[(size_t)i].next;
+                auto *voice = static_cast<Voice *>(voices.getUnchecked(i));
+                if (voice->getChokeGroup() == group)
+                    voice->choke();
+                i = next;
+            }
+        }
+    }
+
+    void voiceStarted(int i, int midiNoteNumber)
+    {
+        unlinkNote(i);
+        moveTo(i, VoiceState::Held);
+        if (juce::isPositiveAndBelow(midiNoteNumber, 128))
+            linkNote(i, midiNoteNumber);
+    }
+
+    void voiceStopped(int i, bool stillSounding)
+    {
+        auto &l = links[(size_t)i];
+        if (l.state == VoiceState::Free)
+            return;
+
+        unlinkNote(i);
+        if (!stillSounding)
+            moveTo(i, VoiceState::Free);
+        else if (l.state == VoiceState::Held)
+            moveTo(i, VoiceState::Released);
+    }
+
+    std::vector<Link> links;
+    List freeList, heldList, releasedList;
+    std::array<int, 128> noteHeads{};
+    std::array<juce::AudioBuffer<float> *, maxOutputBuses> outputBuses{};
+    int numOutputBuses = 0;
+    std::atomic<bool> resampleToPlaybackRate{false};
+    std::atomic<double> playbackRate{0.0};
+    juce::ThreadPool resamplePool{1};
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PolySynthesiser)
+};
@@ -0,0 +1,382 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+
+/**
+    SampleSound: a sample decoded once into memory for SampleVoice to play.
+
+    Works like juce::SamplerSound, but the decoded data is padded with guard
+    samples on both sides so the interpolation kernels never need bounds checks.
+    The data can be resampled to the session rate ahead of time (see
+    createResampled), leaving voices with only the pitch ratio to interpolate.
+*/
+class SampleSound : public juce::SynthesiserSound
+{
+public:
+    static constexpr int leadingGuard = 1;
+    static constexpr int trailingGuard = 3;
+
+    /**
+        One version of the sample's audio. Voices keep the version they started
+        with, so a sound's data can be replaced (see swapData) while they play.
+    */
+    struct Data : public juce::ReferenceCountedObject
+    {
+        using Ptr = juce::ReferenceCountedObjectPtr<Data>;
+
+        juce::AudioBuffer<float> buffer; // padded with guard samples on both sides
+        int length = 0;                  // samples between the guards
+        double sampleRate = 0.0;
+    };
+
+    SampleSound(const juce::String &soundName,
+                juce::AudioFormatReader &source,
+                const juce::BigInteger &notes,
+                int midiNoteForNormalPitch,
+                double attackTimeSecs,
+                double releaseTimeSecs,
+                double maxSampleLengthSeconds)
+        : name(soundName),
+          data(new Data()),
+          midiNotes(notes),
+          midiRootNote(midiNoteForNormalPitch)
+    {
+        data->sampleRate = source.sampleRate;
+
+        if (source.sampleRate > 0 && source.lengthInSamples > 0)
+        {
+            data->length = (int)juce::jmin((juce::int64)source.lengthInSamples,
+                                           (juce::int64)(maxSampleLengthSeconds * source.sampleRate));
+
+            data->buffer.setSize(juce::jmin(2, (int)source.numChannels), leadingGuard + data->length + trailingGuard);
+            data->buffer.clear();
+            source.read(&data->buffer, leadingGuard, data->length, 0, true, true);
+
+            params.attack = (float)attackTimeSecs;
+            params.release = (float)releaseTimeSecs;
+        }
+
+        original = data;
+    }
+
+    const juce::String &getName() const noexcept { return name; }
+    const juce::AudioBuffer<float> &getAudioData() const noexcept { return data->buffer; }
+    int getLength() const noexcept { return data->length; }
+
+    // Rate of the data new notes play: the file's rate until it has been resampled
+    double getSampleRate() const noexcept { return data->sampleRate; }
+
+    /** The data new notes play. Read it with the synth's lock held. */
+    Data::Ptr getData() const noexcept { return data; }
+
+    /**
+        Returns the decoded sample resampled to targetRate (low-pass filtered when
+        going down, so it stays band-limited), padded like the playback data.
+        Always works from the original decode and never touches the data voices are
+        reading, so it can run on a background thread; install the result with
+        swapData() while holding the synth's lock.
+    */
+    Data::Ptr createResampled(double targetRate) const
+    {
+        if (targetRate == original->sampleRate)
+            return original;
+
+        const int numChannels = original->buffer.getNumChannels();
+        const double ratio = original->sampleRate / targetRate;
+
+        Data::Ptr resampled(new Data());
+        resampled->sampleRate = targetRate;
+        resampled->length = original->length > 0 ? (int)std::ceil(original->length / ratio) : 0;
+        resampled->buffer.setSize(numChannels, leadingGuard + resampled->length + trailingGuard);
+        resampled->buffer.clear();
+
+        if (resampled->length == 0)
+            return resampled;
+
+        // The resampler only reads the source, so it can share the original's memory
+        juce::AudioBuffer<float> source(const_cast<float *const *>(original->buffer.getArrayOfReadPointers()),
+                                        numChannels, leadingGuard, original->length);
+        juce::MemoryAudioSource sourceReader(source, false);
+        juce::ResamplingAudioSource resampler(&sourceReader, false, numChannels);
+        resampler.setResamplingRatio(ratio);
+        resampler.prepareToPlay(resampled->length, targetRate);
+
+        juce::AudioSourceChannelInfo info(&resampled->buffer, leadingGuard, resampled->length);
+        resampler.getNextAudioBlock(info);
+        return resampled;
+    }
+
+    /**
+        Makes newData the data new notes play. Voices already playing finish with the
+        data they started on, which is kept here until releaseUnusedData() finds them
+        done, so it's never freed on the audio thread. Call with the synth's lock held,
+        from the one thread that also calls releaseUnusedData().
+    */
+    void swapData(Data::Ptr newData)
+    {
+        if (data != original)
+            retired.add(data);
+        data = std::move(newData);
+    }
+
+    /** Frees the replaced data that no voice is playing any more. Don't hold the synth's lock. */
+    void releaseUnusedData()
+    {
+        for (int i = retired.size(); --i >= 0;)
+            if (retired.getObjectPointerUnchecked(i)->getReferenceCount() == 1)
+                retired.remove(i);
+    }
+
+    void setEnvelopeParameters(juce::ADSR::Parameters parametersToUse) { params = parametersToUse; }
+
+    // Mix settings applied when a voice starts (used by drum kit pads)
+    void setGain(float newGain) noexcept { gain.store(newGain); }
+    void setPan(float newPan) noexcept { pan.store(juce::jlimit(-1.0f, 1.0f, newPan)); }
+    float getGain() const noexcept { return gain.load(); }
+    float getPan() const noexcept { return pan.load(); }
+
+    // Sounds sharing a non-zero choke group cut each other off (e.g. open/closed hi-hat)
+    void setChokeGroup(int group) noexcept { chokeGroup = group; }
+    int getChokeGroup() const noexcept { return chokeGroup; }
+
+    // 0 renders to the main output, n > 0 to the n-th extra output bus when it's enabled
+    void setOutputBus(int bus) noexcept { outputBus = bus; }
+    int getOutputBus() const noexcept { return outputBus; }
+
+    bool appliesToNote(int midiNoteNumber) override { return midiNotes[midiNoteNumber]; }
+    bool appliesToChannel(int) override { return true; }
+
+private:
+    friend class SampleVoice;
+
+    juce::String name;
+    Data::Ptr data;
+    Data::Ptr original;                     // the file's decode
+    juce::ReferenceCountedArray<Data> retired; // replaced data voices may still be playing
+    juce::BigInteger midiNotes;
+    int midiRootNote = 60;
+    juce::ADSR::Parameters params;
+    std::atomic<float> gain{1.0f}, pan{0.0f};
+    int chokeGroup = 0;
+    int outputBus = 0;
+
+    JUCE_LEAK_DETECTOR(SampleSound)
+};
+
+/**
+    SampleVoice: plays a SampleSound in fixed-size blocks.
+
+    Each block fills the envelope once, then runs a branch-free interpolation
+    kernel (linear or 4-point Hermite) that applies the envelope in the same
+    pass, and mixes the result into the output with vector multiply-adds that
+    carry velocity, gain and pan. Mono samples are interpolated once and sent
+    to both output channels.
+*/
+class SampleVoice : public juce::SynthesiserVoice
+{
+public:
+    enum class Interpolation
+    {
+        linear,
+        hermite
+    };
+
+    SampleVoice() = default;
+
+    void setInterpolation(Interpolation newInterpolation) noexcept { interpolation = newInterpolation; }
+    Interpolation getInterpolation() const noexcept { return interpolation; }
+
+    bool canPlaySound(juce::SynthesiserSound *sound) override
+    {
+        return dynamic_cast<const SampleSound *>(sound) != nullptr;
+    }
+
+    void startNote(int midiNoteNumber, float velocity, juce::SynthesiserSound *s, int) override
+    {
+        if (auto *sound = dynamic_cast<const SampleSound *>(s))
+        {
+            // Keep this version of the data for the whole note, even if the sound's is swapped
+            playing = sound->getData();
+            pitchRatio = std::pow(2.0, (midiNoteNumber - sound->midiRootNote) / 12.0) * playing->sampleRate / getSampleRate();
+            sourceSamplePosition = 0.0;
+
+            // Balance pan law: centre keeps unity gain on both sides
+            const float p = sound->getPan();
+            gain = velocity * sound->getGain();
+            leftGain = gain * juce::jmin(1.0f, 1.0f - p);
+            rightGain = gain * juce::jmin(1.0f, 1.0f + p);
+
+            adsr.setSampleRate(getSampleRate());
+            adsr.setParameters(sound->params);
+            adsr.noteOn();
+        }
+        else
+        {
+            jassertfalse; // this object can only play SampleSounds!
+        }
+    }
+
+    void stopNote(float, bool allowTailOff) override
+    {
+        if (allowTailOff)
+        {
+            adsr.noteOff();
+        }
+        else
+        {
+            endNote();
+            adsr.reset();
+        }
+    }
+
+    /** Fades the voice out over a few milliseconds, e.g. a closed hi-hat cutting an open one. */
+    void choke()
+    {
+        if (auto *sound = static_cast<const SampleSound *>(getCurrentlyPlayingSound().get()))
+        {
+            auto chokeParams = sound->params;
+            chokeParams.release = chokeTimeSeconds;
+            adsr.setParameters(chokeParams);
+            adsr.noteOff();
+        }
+    }
+
+    int getChokeGroup() const
+    {
+        if (auto *sound = static_cast<const SampleSound *>(getCurrentlyPlayingSound().get()))
+            return sound->getChokeGroup();
+        return 0;
+    }
+
+    int getOutputBus() const
+    {
+        if (auto *sound = static_cast<const SampleSound *>(getCurrentlyPlayingSound().get()))
+            return sound->getOutputBus();
+        return 0;
+    }
+
+    void pitchWheelMoved(int) override {}
+    void controllerMoved(int, int) override {}
+
+    using juce::SynthesiserVoice::renderNextBlock;
+
+    void renderNextBlock(juce::AudioBuffer<float> &outputBuffer, int startSample, int numSamples) override
+    {
+        if (playing == nullptr)
+            return;
+
+        const auto &data = playing->buffer;
+        const bool stereoSource = data.getNumChannels() > 1;
+        const float *inL = data.getReadPointer(0) + SampleSound::leadingGuard;
+        const float *inR = stereoSource ? data.getReadPointer(1) + SampleSound::leadingGuard : nullptr;
+
+        float *outL = outputBuffer.getWritePointer(0, startSample);
+        float *outR = outputBuffer.getNumChannels() > 1 ? outputBuffer.getWritePointer(1, startSample) : nullptr;
+
+        while (numSamples > 0)
+        {
+            // Number of output samples before the read head passes the end of the sample
+            const int available = (int)std::ceil((playing->length - sourceSamplePosition) / pitchRatio);
+            const int n = juce::jmin(numSamples, blockSize, available);
+
+            if (n <= 0)
+            {
+                stopNote(0.0f, false);
+                return;
+            }
+
+            for (int k = 0; k < n; ++k)
+                envelope[(size_t)k] = adsr.getNextSample();
+
+            interpolate(inL, left.data(), n);
+            if (stereoSource)
+                interpolate(inR, right.data(), n);
+
+            if (outR != nullptr)
+            {
+                juce::FloatVectorOperations::addWithMultiply(outL, left.data(), leftGain, n);
+                juce::FloatVectorOperations::addWithMultiply(outR, stereoSource ? right.data() : left.data(), rightGain, n);
+            }
+            else if (stereoSource)
+            {
+                juce::FloatVectorOperations::addWithMultiply(outL, left.data(), 0.5f * gain, n);
+                juce::FloatVectorOperations::addWithMultiply(outL, right.data(), 0.5f * gain, n);
+            }
+            else
+            {
+                juce::FloatVectorOperations::addWithMultiply(outL, left.data(), gain, n);
+            }
+
+            sourceSamplePosition += n * pitchRatio;
+            outL += n;
+            if (outR != nullptr)
+                outR += n;
+            numSamples -= n;
+
+            if (!adsr.isActive())
+            {
+                endNote();
+                return;
+            }
+        }
+    }
+
+private:
+    static constexpr int blockSize = 128;
+    static constexpr float chokeTimeSeconds = 0.005f;
+
+    void endNote()
+    {
+        clearCurrentNote();
+        playing = nullptr;
+    }
+
+    void interpolate(const float *src, float *dest, int n) const noexcept
+    {
+        if (interpolation == Interpolation::hermite)
+            interpolateHermite(src, sourceSamplePosition, pitchRatio, envelope.data(), dest, n);
+        else
+            interpolateLinear(src, sourceSamplePosition, pitchRatio, envelope.data(), dest, n);
+    }
+
+    static void interpolateLinear(const float *src, double pos, double ratio,
+                                  const float *env, float *dest, int n) noexcept
+    {
+        for (int k = 0; k < n; ++k)
+        {
+            const double p = pos + k * ratio;
+            const int i = (int)p;
+            const float f = (float)(p - i);
+            const float x0 = src[i], x1 = src[i + 1];
+            dest[k] = (x0 + f * (x1 - x0)) * env[k];
+        }
+    }
+
+    static void interpolateHermite(const float *src, double pos, double ratio,
+                                   const float *env, float *dest, int n) noexcept
+    {
+        for (int k = 0; k < n; ++k)
+        {
+            const double p = pos + k * ratio;
+            const int i = (int)p;
+            const float f = (float)(p - i);
+            const float xm1 = src[i - 1], x0 = src[i], x1 = src[i + 1], x2 = src[i + 2];
+            const float c1 = 0.5f * (x1 - xm1);
+            const float c2 = xm1 - 2.5f * x0 + 2.0f * x1 - 0.5f * x2;
+            const float c3 = 0.5f * (x2 - xm1) + 1.5f * (x0 - x1);
+            dest[k] = (((c3 * f + c2) * f + c1) * f + x0) * env[k];
+        }
+    }
+
+    Interpolation interpolation = Interpolation::hermite;
+    SampleSound::Data::Ptr playing;
+    double pitchRatio = 1.0;
+    double sourceSamplePosition = 0.0;
+    float gain = 1.0f, leftGain = 1.0f, rightGain = 1.0f;
+    juce::ADSR adsr;
+
+    std::array<float, blockSize> envelope{}, left{}, right{};
+
+    JUCE_LEAK_DETECTOR(SampleVoice)
+};
@@ -0,0 +1 @@
+#include "jb_sampler.h"
@@ -0,0 +1,26 @@
+/*******************************************************************************
+ The block below describes the properties of this module, and is read by
+ the Projucer to automatically generate project code that uses it.
+
+ BEGIN_JUCE_MODULE_DECLARATION
+
+  ID:                 jb_sampler
+  vendor:             JBlanked
+  version:            1.0.0
+  name:               JBlanked sampler
+  description:        Polyphonic in-memory sample playback shared by the JBlanked instruments.
+  website:            www.jblanked.com
+  minimumCppStandard: 17
+
+  dependencies:       juce_audio_basics juce_audio_formats
+
+ END_JUCE_MODULE_DECLARATION
+*******************************************************************************/
+
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <juce_audio_formats/juce_audio_formats.h>
+
+#include "Sampler/SampleVoice.h"
+#include "Sampler/PolySynthesiser.h"